@@ -0,0 +1,289 @@
+/*
+ * AutoClock.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Clock policy bound once at startup to the best available time source
+ */
+
+#ifndef STM32_TOOLS_TIME_AUTOCLOCK_H_
+#define STM32_TOOLS_TIME_AUTOCLOCK_H_
+
+#include "interval_depency.h"
+#include <array>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+//------------------------------------------------------------------------------
+// AutoClockOf<Sources...>
+//  - Sources: clock policies in order of preference (type_t, now(),
+//    isAvailable(), ticksPerSecond())
+//  - select() (once at startup, also done by isAvailable()) probes every
+//    source: isAvailable(), a known rate, then read cost (64 back-to-back
+//    reads timed on the source itself) and resolution (smallest step seen,
+//    at least one tick). Score = max(cost, resolution) in ns: a counter can
+//    not resolve finer than it can be read. Lowest score wins, ties keep the
+//    earlier source.
+//  - now() has no branch: one source -> that source's now(), inlined;
+//    several -> one indirect call through the pointer select() stored. That
+//    pointer is the fallback for when the best source is only known at run
+//    time; once it is known for a build, bind it at compile time:
+//  - Fixed<I>: the same clock bound to source I without probing, now()
+//    inlined. -DTIME_AUTOCLOCK_SOURCE=I makes AutoClock that policy.
+//  - type_t is the narrowest source type; wider sources are read modulo it,
+//    so wrap-around arithmetic stays valid whichever source was chosen
+//  - ticksPerSecond() is the rate of the selected source: build intervals
+//    with fromNanos()/from() instead of hard-coded tick counts
+//
+// Call select() before timers and ISRs use now(); the binding is a plain
+// pointer store, not synchronized with concurrent readers.
+//
+//     AutoClock::isAvailable();                                   // startup
+//     ITimeBase<0u, AutoClock> t(AutoClock::from(250us));
+//
+//     using Clk = AutoClockOf<Dwt, HTimer, Tick>::Fixed<0>;       // Dwt, inlined
+//------------------------------------------------------------------------------
+
+// Result of probing one source
+struct AutoClockProbe {
+    bool available    = false;
+    u64  hz           = 0;
+    u32  costNs       = 0;   ///< one now() call
+    u32  resolutionNs = 0;   ///< smallest observed step
+};
+
+namespace auto_clock_detail {
+
+template<typename A, typename... Rest>
+struct narrowest { using type = A; };
+
+template<typename A, typename B, typename... Rest>
+struct narrowest<A, B, Rest...>
+    : narrowest<std::conditional_t<(sizeof(B) < sizeof(A)), B, A>, Rest...> {};
+
+template<class S>
+AutoClockProbe probe() noexcept {
+    AutoClockProbe p{};
+    if (!S::isAvailable()) {
+        return p;
+    }
+    p.hz = static_cast<u64>(S::ticksPerSecond());
+    if (p.hz == 0u) {
+        return p;                     // rate unknown: intervals could not be converted
+    }
+    p.available = true;
+
+    using T = typename S::type_t;
+    constexpr u32 reads = 64;
+
+    T step = std::numeric_limits<T>::max();
+    T prev = S::now();
+    const T t0 = prev;
+    for (u32 i = 0; i < reads; ++i) {
+        const T t = S::now();
+        const T d = static_cast<T>(t - prev);
+        if (d != T{0} && d < step) {
+            step = d;
+        }
+        prev = t;
+    }
+    const u64 spent = static_cast<u64>(static_cast<T>(prev - t0));
+    if (step == std::numeric_limits<T>::max()) {
+        step = T{1};                  // no change seen: one tick
+    }
+
+    const u64 cost = (spent * 1'000'000'000ull) / (p.hz * reads);
+    const u64 res  = (static_cast<u64>(step) * 1'000'000'000ull + p.hz - 1u) / p.hz;
+    p.costNs       = static_cast<u32>((cost > 0xFFFFFFFFull) ? 0xFFFFFFFFull : cost);
+    p.resolutionNs = static_cast<u32>((res  > 0xFFFFFFFFull) ? 0xFFFFFFFFull : res);
+    return p;
+}
+
+} /* namespace auto_clock_detail */
+
+template<class... Sources>
+class AutoClockOf
+{
+    STATIC_CLASS(AutoClockOf);
+    static_assert(sizeof...(Sources) > 0, "AutoClockOf: at least one source required");
+
+public:
+    using type_t = typename auto_clock_detail::narrowest<typename Sources::type_t...>::type;
+    static_assert(std::is_unsigned_v<type_t>, "AutoClockOf: source types must be unsigned");
+
+    using reader_t = type_t (*)() noexcept;
+
+    static constexpr u8 count = static_cast<u8>(sizeof...(Sources));
+
+    /**
+     * @brief Current time of the selected source.
+     */
+    static inline type_t now() noexcept {
+        if constexpr (count == 1u) {
+            return read<Sources...>();
+        } else {
+            return _read();
+        }
+    }
+
+    /**
+     * @brief Probes all sources and binds now() to the best one.
+     * @return true if a usable source was found (otherwise the first one stays bound).
+     */
+    static bool select() noexcept {
+        constexpr std::array<AutoClockProbe (*)() noexcept, count> probes{ &auto_clock_detail::probe<Sources>... };
+        constexpr std::array<reader_t, count> readers{ &read<Sources>... };
+
+        u8  best  = count;
+        u32 score = 0;
+        for (u8 i = 0; i < count; ++i) {
+            _probes[i] = probes[i]();
+            if (!_probes[i].available) {
+                continue;
+            }
+            const u32 s = (_probes[i].costNs > _probes[i].resolutionNs) ? _probes[i].costNs
+                                                                        : _probes[i].resolutionNs;
+            if (best == count || s < score) {
+                best  = i;
+                score = s;
+            }
+        }
+
+        if (best == count) {
+            return false;
+        }
+        _selected = best;
+        _hz       = _probes[best].hz;
+        if constexpr (count > 1u) {
+            _read = readers[best];
+        }
+        return true;
+    }
+
+    // Call once at startup: selects the source
+    static bool isAvailable() noexcept { return select(); }
+
+    [[nodiscard]] static u64 ticksPerSecond() noexcept { return _hz; }
+    [[nodiscard]] static u8 selected() noexcept { return _selected; }
+    [[nodiscard]] static const AutoClockProbe& probe(const u8 i) noexcept { return _probes[i]; }
+
+    /*
+     * Interval helpers (selected rate, rounded up)
+     */
+
+    [[nodiscard]] static type_t fromNanos(const u64 ns) noexcept {
+        return static_cast<type_t>(mulDivUp(ns, _hz, 1'000'000'000ull));
+    }
+
+    template<typename Rep, typename Period>
+    [[nodiscard]] static type_t from(const std::chrono::duration<Rep, Period> d) noexcept {
+        return fromNanos(static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count()));
+    }
+
+    [[nodiscard]] static u64 toNanos(const type_t ticks) noexcept {
+        return _hz ? mulDivUp(ticks, 1'000'000'000ull, _hz) : 0u;
+    }
+
+    /**
+     * @brief Compile-time binding to source I: same type_t and helpers,
+     *        now() is the source's now(), inlined; no probing, no pointer.
+     */
+    template<u8 I>
+    class Fixed
+    {
+        STATIC_CLASS(Fixed);
+        static_assert(I < count, "AutoClockOf::Fixed: source index out of range");
+
+    public:
+        using source = std::tuple_element_t<I, std::tuple<Sources...>>;
+        using type_t = typename AutoClockOf::type_t;
+
+        static inline type_t now() noexcept { return read<source>(); }
+
+        // Nothing to select: the source is usable if it runs and has a rate
+        static bool select() noexcept { return source::isAvailable() && ticksPerSecond() != 0u; }
+        static bool isAvailable() noexcept { return select(); }
+
+        [[nodiscard]] static u64 ticksPerSecond() noexcept { return static_cast<u64>(source::ticksPerSecond()); }
+        [[nodiscard]] static constexpr u8 selected() noexcept { return I; }
+
+        [[nodiscard]] static type_t fromNanos(const u64 ns) noexcept {
+            return static_cast<type_t>(mulDivUp(ns, ticksPerSecond(), 1'000'000'000ull));
+        }
+
+        template<typename Rep, typename Period>
+        [[nodiscard]] static type_t from(const std::chrono::duration<Rep, Period> d) noexcept {
+            return fromNanos(static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count()));
+        }
+
+        [[nodiscard]] static u64 toNanos(const type_t ticks) noexcept {
+            const u64 hz = ticksPerSecond();
+            return hz ? mulDivUp(ticks, 1'000'000'000ull, hz) : 0u;
+        }
+    };
+
+private:
+    template<class S>
+    static type_t read() noexcept { return static_cast<type_t>(S::now()); }
+
+    // a * b / c rounded up, a * b split to stay inside u64 for GHz-range rates
+    static u64 mulDivUp(const u64 a, const u64 b, const u64 c) noexcept {
+        const u64 q = a / c;
+        const u64 r = a % c;
+        return q * b + (r * b + c - 1u) / c;
+    }
+
+    template<class First, class...>
+    static constexpr reader_t first() noexcept { return &read<First>; }
+
+private:
+    static inline reader_t _read = first<Sources...>();
+    static inline u64 _hz       = 0;
+    static inline u8  _selected = 0;
+    static inline std::array<AutoClockProbe, count> _probes{};
+};
+
+//------------------------------------------------------------------------------
+// AutoClock: the sources this build has, best first (AutoClockSources).
+// -DTIME_AUTOCLOCK_SOURCE=I binds it to source I at compile time (Fixed<I>),
+// e.g. once selected() has been read on the board.
+//------------------------------------------------------------------------------
+#ifndef TIME_HOST_BUILD
+
+#include "Tick.h"
+#include "Dwt.h"
+#include "HTimer.h"
+
+#if defined(DWT_TIME_IS_EXISTS) && defined(HAL_TIM_MODULE_ENABLED)
+using AutoClockSources = AutoClockOf<Dwt, HTimer, Tick>;
+#elif defined(DWT_TIME_IS_EXISTS)
+using AutoClockSources = AutoClockOf<Dwt, Tick>;
+#elif defined(HAL_TIM_MODULE_ENABLED)
+using AutoClockSources = AutoClockOf<HTimer, Tick>;
+#else
+using AutoClockSources = AutoClockOf<Tick>;
+#endif
+
+#else /* TIME_HOST_BUILD */
+
+#include "LinuxClock.h"
+
+#if defined(TSC_TIME_IS_EXISTS)
+using AutoClockSources = AutoClockOf<Tsc, Monotonic>;
+#elif defined(LINUX_TIME_IS_EXISTS)
+using AutoClockSources = AutoClockOf<Monotonic>;
+#endif
+
+#endif /* TIME_HOST_BUILD */
+
+#if !defined(TIME_HOST_BUILD) || defined(LINUX_TIME_IS_EXISTS)
+#ifdef TIME_AUTOCLOCK_SOURCE
+using AutoClock = AutoClockSources::Fixed<TIME_AUTOCLOCK_SOURCE>;
+#else
+using AutoClock = AutoClockSources;
+#endif
+#endif
+
+#endif /* STM32_TOOLS_TIME_AUTOCLOCK_H_ */
@@ -0,0 +1,91 @@
+/*
+ * CachedClock.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Snapshot clock policy: one Policy::now() read per loop pass, shared by all timers
+ */
+
+#ifndef STM32_TOOLS_TIME_CACHEDCLOCK_H_
+#define STM32_TOOLS_TIME_CACHEDCLOCK_H_
+
+#include "interval_depency.h"
+#include <type_traits>
+
+//------------------------------------------------------------------------------
+// CachedClock<Policy, Tag>:
+//  - now() returns the snapshot taken by the last refresh(), a plain load
+//  - every timer on the same CachedClock sees the same instant during a pass,
+//    so timers compared against each other stay consistent
+//  - Tag separates independent snapshots of the same source (e.g. per thread)
+//
+// Superloop:
+//     using Clk = CachedClock<Tick>;
+//     for (;;) {
+//         Clk::refresh();                 // one uwTick read
+//         if (blink.isExpired()) ...      // ITimeBase<500u, Clk>, no further reads
+//     }
+//
+// Interrupts: a handler that uses timers on the same CachedClock opens a
+// CachedClock::Scope. It refreshes on entry and restores the interrupted
+// snapshot on exit, so the preempted pass never sees its time move. Scopes
+// nest (LIFO, like interrupt preemption). The snapshot store is a single
+// word write for <= 32-bit type_t, larger types need the same Tag
+// not to be used from contexts that preempt each other.
+//------------------------------------------------------------------------------
+template<class Policy, class Tag = void>
+class CachedClock
+{
+    STATIC_CLASS(CachedClock);
+
+public:
+    using type_t = typename Policy::type_t;
+    using source = Policy;
+
+    static_assert(std::is_unsigned_v<type_t>, "CachedClock: Policy::type_t must be unsigned");
+
+    // Snapshot of the last refresh()
+    static inline type_t now() noexcept { return _now; }
+
+    // Take a new snapshot, returns it
+    static inline type_t refresh() noexcept(noexcept(Policy::now())) {
+        const type_t t = static_cast<type_t>(Policy::now());
+        _now = t;
+        return t;
+    }
+
+    static inline bool isAvailable() noexcept { return Policy::isAvailable(); }
+
+    /**
+     * @brief Scoped refresh: snapshot on construction, previous snapshot
+     *        restored on destruction. Safe to use in interrupt handlers.
+     */
+    class Scope
+    {
+    public:
+        Scope() noexcept(noexcept(Policy::now())) : _saved(_now) { refresh(); }
+        ~Scope() { _now = _saved; }
+
+        _DELETE_COPY_MOVE(Scope);
+
+        [[nodiscard]] type_t now() const noexcept { return _now; }
+
+    private:
+        const type_t _saved;
+    };
+
+private:
+    static inline type_t _now = 0;
+};
+
+// interval ----------------------------
+#include "interval/ITimeBase.h"
+template<class Policy, auto Interval = 0u, class Tag = void>
+using CachedITimer = ITimeBase<Interval, CachedClock<Policy, Tag>>;
+
+#include "interval/OneShotIBase.h"
+template<class Policy, auto Interval = 0u, class Tag = void>
+using CachedOneShotI = OneShotIBase<Interval, CachedClock<Policy, Tag>>;
+
+#endif /* STM32_TOOLS_TIME_CACHEDCLOCK_H_ */
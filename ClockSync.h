@@ -0,0 +1,233 @@
+/*
+ * ClockSync.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Fixed-point offset/rate estimator mapping local ticks onto a reference timebase
+ */
+
+#ifndef STM32_TOOLS_TIME_CLOCKSYNC_H_
+#define STM32_TOOLS_TIME_CLOCKSYNC_H_
+
+#include "interval_depency.h"
+#include <type_traits>
+#include <limits>
+
+//------------------------------------------------------------------------------
+// ClockSync<Policy>
+//  - feed (local timestamp, reference timestamp) sync pairs with update()
+//  - toReference(local) maps any local timestamp near the last sync onto the
+//    reference timebase: one subtraction, two 32x32->64 multiplies, one add
+//  - integer arithmetic only, no division on the conversion path
+//
+// The fit is a fixed-point alpha-beta filter on the line ref = a + rate * local:
+// the steady-state recursive least-squares estimator for offset and rate.
+// Gains are powers of two (AlphaShift, BetaShift): larger = smoother, slower.
+//
+// Local counter wrap: Policy::type_t is unwrapped modulo its width, so syncs
+// must arrive at least every half counter range (Dwt @168 MHz: ~12 s, Tick: ~24 days)
+// and toReference() must be called within half a range of the last sync.
+//
+// Outliers: residuals larger than OutlierGain * (running mean |residual|) +
+// max(minGate, 2 local ticks) are rejected; the floor keeps the gate open
+// after a quiet period (set minGate to the reference timestamp noise). The
+// second pair has no residual history: its rate must be within maxSkewPpm of
+// the nominal one. MaxRejects consecutive rejections mean the reference
+// really stepped (or the first pair was the outlier), the estimator then
+// re-anchors on the new pair.
+//------------------------------------------------------------------------------
+
+template<class Policy,
+         unsigned AlphaShift  = 2,
+         unsigned BetaShift   = 4,
+         unsigned OutlierGain = 4,
+         u8       MaxRejects  = 3>
+class ClockSync
+{
+public:
+    using local_type = typename Policy::type_t;
+    using ref_type   = u64;
+    using rate_type  = u64;   ///< reference ticks per local tick, Q32.32
+
+private:
+    static_assert(std::is_unsigned_v<local_type> && sizeof(local_type) <= sizeof(u32),
+                  "ClockSync: Policy::type_t must be unsigned and at most 32-bit");
+    static_assert(AlphaShift < 16 && BetaShift < 16, "ClockSync: gain shifts out of range");
+
+    static constexpr unsigned   local_bits = std::numeric_limits<local_type>::digits;
+    static constexpr local_type local_half = static_cast<local_type>(local_type{1} << (local_bits - 1));
+
+public:
+    /**
+     * @brief Construct with the nominal rate.
+     * @param refPerLocalQ32 expected reference ticks per local tick, Q32.32 (see ratio()).
+     * @param minGate        smallest residual (reference ticks) never treated as outlier,
+     *                       at least two local ticks.
+     * @param maxSkewPpm     largest rate error vs. nominal accepted from the second pair.
+     */
+    constexpr explicit ClockSync(const rate_type refPerLocalQ32 = rate_type{1} << 32,
+                                 const u32 minGate = 0, const u32 maxSkewPpm = 1000) noexcept
+        : _rate(refPerLocalQ32), _nominal(refPerLocalQ32), _minGate(minGate), _maxSkewPpm(maxSkewPpm) {}
+
+    /// @brief Nominal rate helper: refHz / localHz as Q32.32.
+    static constexpr rate_type ratio(const u64 refHz, const u64 localHz) noexcept {
+        return static_cast<rate_type>(((refHz << 32) + localHz / 2u) / localHz);
+    }
+
+    /**
+     * @brief Feed one sync pair.
+     * @return true if accepted, false if rejected as an outlier.
+     */
+    bool update(const local_type local, const ref_type ref) noexcept {
+        if (_samples == 0u) {
+            anchor(local, ref);
+            _samples = 1u;
+            return true;
+        }
+
+        const local_type dl = static_cast<local_type>(local - _local);
+        if (dl == 0u || dl >= local_half) {
+            ++_rejected;     // same or older than the anchor: carries no rate information
+            return false;
+        }
+
+        const ref_type  predicted = _ref + scale(dl, _rate);
+        const i64       residual  = static_cast<i64>(ref - predicted);
+        const u64       magnitude = static_cast<u64>(residual < 0 ? -residual : residual);
+
+        if (_samples == 1u) {
+            // second pair: first direct rate measurement, gated against the nominal rate
+            const u64 dref = ref - _ref;
+            const rate_type measured = ((dref / dl) << 32) + (((dref % dl) << 32) / dl);
+            if (!isPlausible(measured)) {
+                if (++_rejects < MaxRejects) {
+                    ++_rejected;
+                    return false;
+                }
+                anchor(local, ref);      // the first pair was the outlier: start over from this one
+                _rejects = 0u;
+                return true;
+            }
+            _rejects = 0u;
+            _rate = measured;
+            anchor(local, ref);
+            _samples = 2u;
+            return true;
+        }
+
+        const u64 gate = (static_cast<u64>(_jitter) * OutlierGain) + gateFloor();
+        if (_samples > 2u && magnitude > gate) {
+            if (++_rejects < MaxRejects) {
+                ++_rejected;
+                return false;
+            }
+            // persistent: the reference stepped, keep the rate, move the line
+            anchor(local, ref);
+            _rejects = 0u;
+            _jitter  = 0u;
+            _samples = 2u;
+            return true;
+        }
+        _rejects = 0u;
+
+        // beta: rate += residual / dl / 2^BetaShift, residual clamped so (r << 32) fits i64
+        const i64 r = clamp31(residual);
+        const i64 drate = ((r * (i64{1} << 32)) / static_cast<i64>(dl)) >> BetaShift;
+        _rate = static_cast<rate_type>(static_cast<i64>(_rate) + drate);
+
+        // alpha: pull the anchor towards the measurement
+        anchor(local, predicted + static_cast<ref_type>(r >> AlphaShift));
+
+        // running mean |residual| (1/8 weight) for the outlier gate
+        const u32 m32 = (magnitude > std::numeric_limits<u32>::max())
+                      ? std::numeric_limits<u32>::max() : static_cast<u32>(magnitude);
+        _jitter = static_cast<u32>(static_cast<i64>(_jitter) + ((static_cast<i64>(m32) - _jitter) >> 3));
+
+        if (_samples < std::numeric_limits<u8>::max()) {
+            ++_samples;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Map a local timestamp onto the reference timebase.
+     *
+     * Valid within half a local counter range around the last accepted sync.
+     */
+    [[nodiscard]] constexpr ref_type toReference(const local_type local) const noexcept {
+        const local_type dl = static_cast<local_type>(local - _local);
+        if (dl < local_half) {
+            return _ref + scale(dl, _rate);
+        }
+        return _ref - scale(static_cast<local_type>(local_type{0} - dl), _rate);
+    }
+
+    /// @brief toReference(Policy::now())
+    [[nodiscard]] ref_type toReference() const noexcept(noexcept(Policy::now())) {
+        return toReference(static_cast<local_type>(Policy::now()));
+    }
+
+    /// @brief Forget everything learned, keep the nominal rate.
+    constexpr void reset() noexcept {
+        _rate = _nominal;
+        _samples = 0u;
+        _rejects = 0u;
+        _jitter = 0u;
+        _rejected = 0u;
+    }
+
+    [[nodiscard]] constexpr bool      isLocked() const noexcept { return _samples > 2u; }
+    [[nodiscard]] constexpr rate_type rate()     const noexcept { return _rate; }
+    [[nodiscard]] constexpr u32       jitter()   const noexcept { return _jitter; }
+    [[nodiscard]] constexpr u32       rejected() const noexcept { return _rejected; }
+
+    /// @brief Rate error vs. nominal in parts per billion.
+    [[nodiscard]] constexpr i32 skewPpb() const noexcept {
+        const i64 d = static_cast<i64>(_rate - _nominal);
+        return static_cast<i32>((d * 1'000'000'000ll) / static_cast<i64>(_nominal));
+    }
+
+private:
+    // dl * rate (Q32.32) -> reference ticks, two 32x32->64 multiplies
+    static constexpr ref_type scale(const local_type dl, const rate_type rate) noexcept {
+        const u64 d = dl;
+        return d * (rate >> 32) + ((d * (rate & 0xFFFF'FFFFull)) >> 32);
+    }
+
+    // |measured - nominal| within maxSkewPpm of nominal
+    constexpr bool isPlausible(const rate_type measured) const noexcept {
+        const u64 d = (measured > _nominal) ? (measured - _nominal) : (_nominal - measured);
+        return d <= (_nominal / 1'000'000u) * _maxSkewPpm + ((_nominal % 1'000'000u) * _maxSkewPpm) / 1'000'000u;
+    }
+
+    // max(minGate, two local ticks in reference ticks): timestamp quantization
+    constexpr u64 gateFloor() const noexcept {
+        const u64 quantum = (_rate >> 32) + 1u;
+        return (_minGate > 2u * quantum) ? _minGate : 2u * quantum;
+    }
+
+    static constexpr i64 clamp31(const i64 v) noexcept {
+        constexpr i64 lim = (i64{1} << 31) - 1;
+        return (v > lim) ? lim : ((v < -lim) ? -lim : v);
+    }
+
+    constexpr void anchor(const local_type local, const ref_type ref) noexcept {
+        _local = local;
+        _ref   = ref;
+    }
+
+private:
+    ref_type   _ref      = 0;   ///< reference time at the anchor
+    rate_type  _rate;           ///< reference ticks per local tick, Q32.32
+    rate_type  _nominal;        ///< rate used before the first measurement
+    local_type _local    = 0;   ///< local time at the anchor
+    u32        _minGate;        ///< outlier gate floor, reference ticks
+    u32        _maxSkewPpm;     ///< second-pair rate gate
+    u32        _jitter   = 0;   ///< running mean |residual|, reference ticks
+    u32        _rejected = 0;   ///< outliers rejected so far
+    u8         _samples  = 0;   ///< accepted pairs (saturating)
+    u8         _rejects  = 0;   ///< consecutive rejections
+};
+
+#endif /* STM32_TOOLS_TIME_CLOCKSYNC_H_ */
@@ -0,0 +1,312 @@
+/*
+ * CpuMonitor.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * CPU load, interrupt cost and critical-section length measured on the cycle counter
+ */
+
+#ifndef STM32_TOOLS_TIME_CPUMONITOR_H_
+#define STM32_TOOLS_TIME_CPUMONITOR_H_
+
+#include "interval_depency.h"
+
+//------------------------------------------------------------------------------
+// Build flags:
+//   -DTIME_CPU_MONITOR=1         enable the monitor. Off by default: every probe
+//                                below is then an empty object and no clock is read
+//   -DTIME_CPU_MONITOR_LOCKS=1   also record every TimeLock section (MonitoredLock)
+//   -DTIME_MONITOR_CLOCK=Policy  time source, default Dwt on target, Monotonic on host
+//
+// Usage:
+//     CpuMonitor::isAvailable();                  // once, starts the DWT counter
+//     for (;;) {                                  // superloop
+//         { CpuMonitor::Idle idle; __WFI(); }     // or one pass of idle work
+//         ...
+//     }
+//     void TIM6_IRQHandler() { CpuMonitor::Probe<struct Tim6Probe> p; ... }
+//
+//     CpuMonitor::load();                                  // busy per mille
+//     CpuMonitor::Probe<SysTickProbe>::stats().max;        // worst SysTick cost
+//     CpuMonitor::longestSection().file / .line            // longest TimeLock
+//
+// A probe costs two clock reads and a few adds. Probe times include any
+// interrupt that preempts the measured code. Results are written from the
+// measured context and read without locking: a reader may see one sample
+// half-applied (count vs. total), never a torn max.
+//------------------------------------------------------------------------------
+#ifndef TIME_CPU_MONITOR
+#define TIME_CPU_MONITOR 0
+#endif
+
+// Probe tags used by the library
+struct SysTickProbe {};     ///< whole HAL_SYSTICK_Callback()
+struct ProceedProbe {};     ///< VTimer::proceed() inside it
+
+// Cost of one probe, in clock ticks
+struct CycleStats {
+    u64 total = 0;
+    u32 count = 0;
+    u32 last  = 0;
+    u32 max   = 0;
+
+    void add(const u32 cycles) noexcept {
+        total += cycles;
+        ++count;
+        last = cycles;
+        if (cycles > max) {
+            max = cycles;
+        }
+    }
+
+    [[nodiscard]] u32 average() const noexcept {
+        return count ? static_cast<u32>(total / count) : 0u;
+    }
+};
+
+// Longest critical section seen by MonitoredLock
+struct SectionRecord {
+    u32         cycles = 0;
+    const char* file   = nullptr;   ///< where the guard was constructed
+    u32         line   = 0;
+    u32         count  = 0;         ///< sections measured in total
+};
+
+#if TIME_CPU_MONITOR
+
+#ifndef TIME_MONITOR_CLOCK
+#   ifdef TIME_HOST_BUILD
+#       include "LinuxClock.h"
+#       define TIME_MONITOR_CLOCK Monotonic
+#   else
+#       if !(defined(DWT) && defined(DWT_BASE))
+#           error "[CPU MONITOR]: no DWT on this target, define TIME_MONITOR_CLOCK"
+#       else
+
+/**
+ * @brief DWT cycle counter without Dwt's lazy init check on every read.
+ *
+ * Dwt.h is not included here: lock_policy.h pulls this header in, and Dwt.h
+ * includes the timer headers that depend on lock_policy.h.
+ * isAvailable() (Dwt.cpp) starts the counter through Dwt::now().
+ */
+class DwtCycles
+{
+    STATIC_CLASS(DwtCycles);
+public:
+    using type_t = u32;
+
+    static inline type_t now() noexcept { return DWT->CYCCNT; }
+    static bool isAvailable() noexcept;
+};
+
+#       define TIME_MONITOR_CLOCK DwtCycles
+#       define TIME_MONITOR_DWT_CYCLES 1
+#       endif
+#   endif
+#endif
+
+class CpuMonitor
+{
+    STATIC_CLASS(CpuMonitor);
+
+public:
+    using clock  = TIME_MONITOR_CLOCK;
+    using type_t = typename clock::type_t;
+
+    static constexpr bool enabled = true;
+
+    // Default load window: 2^24 ticks (~100 ms at 168 MHz)
+    static constexpr type_t default_window = type_t{1} << 24;
+
+    /**
+     * @brief Marks idle time: construct before WFI / idle work, destroy after.
+     *
+     * Everything between two Idle scopes counts as busy. The load is recomputed
+     * when an Idle scope closes a window (one division per window).
+     */
+    class Idle
+    {
+    public:
+        Idle() noexcept : _t0(clock::now()) {}
+        ~Idle() { idleDone(_t0, clock::now()); }
+
+        _DELETE_COPY_MOVE(Idle);
+
+    private:
+        const type_t _t0;
+    };
+
+    /**
+     * @brief Scoped cost probe. One CycleStats per Tag.
+     */
+    template<class Tag>
+    class Probe
+    {
+    public:
+        Probe() noexcept : _t0(clock::now()) {}
+        ~Probe() { _stats<Tag>.add(static_cast<u32>(clock::now() - _t0)); }
+
+        _DELETE_COPY_MOVE(Probe);
+
+        [[nodiscard]] static const CycleStats& stats() noexcept { return _stats<Tag>; }
+        static void reset() noexcept { _stats<Tag> = CycleStats{}; }
+
+    private:
+        const type_t _t0;
+    };
+
+    // Call once at startup: starts the clock (DWT) and checks it
+    static bool isAvailable() noexcept { return clock::isAvailable(); }
+
+    static void setWindow(const type_t ticks) noexcept { _window = ticks ? ticks : type_t{1}; }
+
+    // Busy share of the last complete window, per mille (0..1000)
+    [[nodiscard]] static u16 load() noexcept { return _load; }
+    [[nodiscard]] static u16 peakLoad() noexcept { return _peak; }
+
+    [[nodiscard]] static const SectionRecord& longestSection() noexcept { return _section; }
+
+    // Called by MonitoredLock while the section is still held
+    static void section(const u32 cycles, const char* const file, const u32 line) noexcept {
+        ++_section.count;
+        if (cycles > _section.cycles) {
+            _section.cycles = cycles;
+            _section.file   = file;
+            _section.line   = line;
+        }
+    }
+
+    // Load and section records (probes: Probe<Tag>::reset())
+    static void reset() noexcept {
+        _started = false;
+        _load    = 0;
+        _peak    = 0;
+        _section = SectionRecord{};
+    }
+
+private:
+    static void idleDone(const type_t t0, const type_t t1) noexcept {
+        if (!_started) {
+            _started = true;
+            _start   = t0;
+            _idle    = 0;
+        }
+        _idle = static_cast<type_t>(_idle + (t1 - t0));
+
+        const type_t span = static_cast<type_t>(t1 - _start);
+        if (span < _window) {
+            return;
+        }
+        const type_t busy = (span > _idle) ? static_cast<type_t>(span - _idle) : type_t{0};
+        _load  = static_cast<u16>(static_cast<u64>(busy) * 1000u / span);
+        _peak  = (_load > _peak) ? _load : _peak;
+        _start = t1;
+        _idle  = 0;
+    }
+
+    template<class Tag>
+    static inline CycleStats _stats{};
+
+    static inline type_t        _window  = default_window;
+    static inline type_t        _start   = 0;
+    static inline type_t        _idle    = 0;
+    static inline u16           _load    = 0;
+    static inline u16           _peak    = 0;
+    static inline bool          _started = false;
+    static inline SectionRecord _section{};
+};
+
+//------------------------------------------------------------------------------
+// MonitoredLock<Lock>: any critical-section guard (IRQGuard, BasepriLock, ...)
+// plus its duration. The file/line default to the statement that constructs
+// the guard (__builtin_FILE/__builtin_LINE, GCC and Clang), so
+//     MonitoredLock<IRQGuard> guard;
+// reports this statement when it is the longest section. A guard built inside
+// a helper (template, wrapper function, TimeLock in library code) reports the
+// helper's line instead: pass the caller's location through, or declare the
+// guard with TIME_MONITORED_LOCK(Lock), which records __FILE__/__LINE__ of the
+// macro. time_tick_locked() forwards the location of its own caller.
+// -DTIME_CPU_MONITOR_LOCKS=1 makes TimeLock a MonitoredLock (lock_policy.h).
+//------------------------------------------------------------------------------
+template<class Lock>
+class MonitoredLock
+{
+public:
+    explicit MonitoredLock(const char* const file = __builtin_FILE(),
+                           const u32 line = __builtin_LINE()) noexcept
+        : _t0(CpuMonitor::clock::now()), _file(file), _line(line) {}
+
+    // recorded before _lock is released
+    ~MonitoredLock() {
+        CpuMonitor::section(static_cast<u32>(CpuMonitor::clock::now() - _t0), _file, _line);
+    }
+
+    _DELETE_COPY_MOVE(MonitoredLock);
+
+private:
+    Lock                     _lock;   ///< taken first, released last
+    const CpuMonitor::type_t _t0;
+    const char* const        _file;
+    const u32                _line;
+};
+
+#else /* !TIME_CPU_MONITOR */
+
+// Same interface, no code and no clock reads
+class CpuMonitor
+{
+    STATIC_CLASS(CpuMonitor);
+
+public:
+    static constexpr bool enabled = false;
+
+    class Idle
+    {
+    public:
+        Idle() noexcept {}
+        ~Idle() noexcept {}   // user-provided: "unused variable" warnings stay quiet
+        _DELETE_COPY_MOVE(Idle);
+    };
+
+    template<class Tag>
+    class Probe
+    {
+    public:
+        Probe() noexcept {}
+        ~Probe() noexcept {}
+        _DELETE_COPY_MOVE(Probe);
+
+        [[nodiscard]] static const CycleStats& stats() noexcept { return _none; }
+        static void reset() noexcept {}
+    };
+
+    static bool isAvailable() noexcept { return false; }
+    static void setWindow(const u64) noexcept {}
+    [[nodiscard]] static u16 load() noexcept { return 0; }
+    [[nodiscard]] static u16 peakLoad() noexcept { return 0; }
+    [[nodiscard]] static const SectionRecord& longestSection() noexcept { return _noSection; }
+    static void reset() noexcept {}
+
+private:
+    static inline const CycleStats    _none{};
+    static inline const SectionRecord _noSection{};
+};
+
+template<class Lock>
+class MonitoredLock : public Lock
+{
+public:
+    explicit MonitoredLock(const char* const = nullptr, const u32 = 0) noexcept {}
+};
+
+#endif /* TIME_CPU_MONITOR */
+
+// Scoped MonitoredLock<Lock> recording the location of this macro
+#define TIME_MONITORED_LOCK_NAME2(l) time_monitored_lock_##l
+#define TIME_MONITORED_LOCK_NAME(l)  TIME_MONITORED_LOCK_NAME2(l)
+#define TIME_MONITORED_LOCK(Lock) \
+    MonitoredLock<Lock> TIME_MONITORED_LOCK_NAME(__LINE__)(__FILE__, static_cast<u32>(__LINE__))
+
+#endif /* STM32_TOOLS_TIME_CPUMONITOR_H_ */
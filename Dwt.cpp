@@ -6,6 +6,8 @@
  */
 
 #include "Dwt.h"
+#include "DwtClock.h"
+#include "CpuMonitor.h"
 
 #if defined(DWT) && defined(DWT_BASE)
 
@@ -38,4 +40,56 @@ bool Dwt::isAvailable() noexcept
 			READ_BIT(DWT->CTRL, DWT_CTRL_CYCCNTENA_Msk));
 }
 
+#ifdef TIME_MONITOR_DWT_CYCLES
+/**
+ * @brief Starts the cycle counter for CpuMonitor (DWT_Init on first call).
+ */
+bool DwtCycles::isAvailable() noexcept
+{
+	(void)Dwt::now();
+	return Dwt::isAvailable();
+}
+#endif /* TIME_MONITOR_DWT_CYCLES */
+
+/**
+ * @brief Registers a rescalable timer (O(1), push front).
+ */
+DwtScaleNode::DwtScaleNode(const Hook hook) noexcept
+	: _hook(hook)
+{
+	TimeLock guard;
+	_next = DwtClock::_head;
+	DwtClock::_head = this;
+}
+
+/**
+ * @brief Removes a rescalable timer from the registry.
+ */
+DwtScaleNode::~DwtScaleNode()
+{
+	TimeLock guard;
+	for (DwtScaleNode** link = &DwtClock::_head; *link; link = &(*link)->_next) {
+		if (*link == this) {
+			*link = _next;
+			break;
+		}
+	}
+}
+
+/**
+ * @brief Rescales all registered timers in a single critical section.
+ */
+void DwtClock::coreClockChanged(const u32 oldHz, const u32 newHz)
+{
+	if (oldHz == 0u || newHz == 0u || oldHz == newHz) {
+		return;
+	}
+
+	TimeLock guard;
+	const Dwt::type_t now = Dwt::now();
+	for (DwtScaleNode* node = _head; node; node = node->_next) {
+		node->_hook(*node, now, oldHz, newHz);
+	}
+}
+
 #endif /* DWT is exists */
@@ -37,6 +37,9 @@ public:
     }
 
 	static bool isAvailable() noexcept;
+
+	// Core clock: the counter runs at SystemCoreClock
+	static inline u32 ticksPerSecond() noexcept { return SystemCoreClock; }
 };
 
 /**
@@ -100,10 +103,18 @@ public:
 template<auto Interval = 0u>
 using DwtITimer = ITimeBase<Interval, Dwt>;
 
+template<auto Interval = 0u>
+using SlackDwtITimer = SlackITimeBase<Interval, Dwt>;
+
 #include "interval/OneShotIBase.h"
 template<auto Interval = 0u>
 using OneShotIDwt = OneShotIBase<Interval, Dwt>;
 
+#include "interval/PackedOneShotIBase.h"
+template<auto Interval = 0u, typename Storage = Dwt::type_t,
+         PackedStore Store = PackedStore::LastTime>
+using PackedOneShotIDwt = PackedOneShotIBase<Interval, Dwt, Storage, Store>;
+
 // virtual ---------------------------------
 #include "virtual/VTimeBase.h"
 template<auto Interval = 0u>
@@ -113,6 +124,12 @@ using DwtVTimer = VTimeBase<Interval, Dwt>;
 template<auto Interval = 0u>
 using OneShotVDwt = OneShotVBase<Interval, Dwt>;
 
+// Per-timer footprint (README, "Virtual timers"): counter + stamp [+ interval]
+static_assert(sizeof(DwtVTimer<100u>) == sizeof(VTimer) + sizeof(Dwt::type_t), "DwtVTimer<100u>: counter + stamp");
+static_assert(sizeof(DwtVTimer<>) == sizeof(VTimer) + 2 * sizeof(Dwt::type_t), "DwtVTimer<>: counter + interval + stamp");
+static_assert(sizeof(OneShotVDwt<100u>) == sizeof(DwtVTimer<100u>), "OneShotVDwt<100u>: state bits live in the stamp");
+static_assert(sizeof(OneShotVDwt<>) == sizeof(DwtVTimer<>), "OneShotVDwt<>: state bits live in the stamp");
+
 
 #endif /* DWT is exists */
 #endif /* STM32_TOOLS_TIME_DWT_H_ */
@@ -0,0 +1,132 @@
+/*
+ * DwtClock.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ */
+
+#ifndef STM32_TOOLS_TIME_DWTCLOCK_H_
+#define STM32_TOOLS_TIME_DWTCLOCK_H_
+
+#include "Dwt.h"
+
+#ifdef DWT_TIME_IS_EXISTS
+
+#include "lock_policy.h"
+#include "virtual/VTimer.h"
+#include <type_traits>
+
+//------------------------------------------------------------------------------
+// Core-clock change support for cycle-based (Dwt) timers.
+//
+// DWT counts core cycles, so an armed interval of N cycles means a different
+// time after SystemCoreClock changes. Stamp-based Dwt timers wrapped in DwtScaled<> register
+// themselves; DwtClock::coreClockChanged() rescales the remaining time and the
+// interval of every registered timer by newHz / oldHz, all inside one TimeLock
+// section, so neither the tick ISR nor another context sees a half-updated set.
+//
+// DwtBuilder holds no cached factors (it reads SystemCoreClock per call),
+// so conversions are correct as soon as SystemCoreClock is updated.
+//
+// VTimer adapters (DwtVTimer<>, OneShotVDwt<>) are not rescaled: they count
+// SysTick ticks, and HAL_RCC_ClockConfig() re-derives SysTick to keep 1 kHz,
+// so their remaining time and interval already mean the same time.
+//
+//     const u32 old = SystemCoreClock;
+//     HAL_RCC_ClockConfig(&clk, latency);   // updates SystemCoreClock
+//     DwtClock::coreClockChanged(old);
+//------------------------------------------------------------------------------
+
+class DwtClock;
+
+/**
+ * @brief Intrusive registry node, non-polymorphic: the rescale hook is a plain
+ *        function pointer set by DwtScaled<>.
+ */
+class DwtScaleNode
+{
+    friend class DwtClock;
+
+protected:
+    using Hook = void (*)(DwtScaleNode&, Dwt::type_t now, u32 oldHz, u32 newHz);
+
+    explicit DwtScaleNode(const Hook hook) noexcept;
+    ~DwtScaleNode();
+
+    _DELETE_COPY_MOVE(DwtScaleNode);
+
+    // v * newHz / oldHz, rounded to nearest
+    static inline Dwt::type_t scale(const Dwt::type_t v, const u32 oldHz, const u32 newHz) noexcept {
+        return static_cast<Dwt::type_t>((static_cast<u64>(v) * newHz + oldHz / 2u) / oldHz);
+    }
+
+private:
+    const Hook    _hook;
+    DwtScaleNode* _next = nullptr;
+};
+
+class DwtClock
+{
+    STATIC_CLASS(DwtClock);
+    friend class DwtScaleNode;
+
+public:
+    /**
+     * @brief Rescales every registered DwtScaled<> timer.
+     * @param oldHz core clock the timers were armed with.
+     * @param newHz new core clock (defaults to the already updated SystemCoreClock).
+     */
+    static void coreClockChanged(const u32 oldHz, const u32 newHz = SystemCoreClock);
+
+private:
+    static inline DwtScaleNode* _head = nullptr;
+};
+
+//------------------------------------------------------------------------------
+// DwtScaled<Timer>:
+//   - Timer is a dynamic stamp-based Dwt adapter: DwtITimer<>, SlackDwtITimer<>,
+//     OneShotIDwt<>
+//   - same API as Timer, plus registration for core-clock rescaling
+//   - static intervals are compile-time cycle counts and cannot be rescaled
+//------------------------------------------------------------------------------
+template<class Timer>
+class DwtScaled : public Timer, private DwtScaleNode
+{
+    using value_type = typename Timer::value_type;
+
+    static_assert(std::is_same_v<value_type, Dwt::type_t>, "DwtScaled: Timer must use the Dwt policy");
+    static_assert(Timer::is_dynamic_interval, "DwtScaled: static-interval timers cannot be rescaled");
+    static_assert(!std::is_base_of_v<VTimer, Timer>,
+                  "DwtScaled: VTimer adapters count SysTick ticks, which keep their rate across core-clock changes");
+
+public:
+    template<typename... Args>
+    explicit DwtScaled(Args&&... args)
+        : Timer(std::forward<Args>(args)...), DwtScaleNode(&DwtScaled::rescale) {}
+
+private:
+    static void rescale(DwtScaleNode& node, const Dwt::type_t now, const u32 oldHz, const u32 newHz) {
+        auto& self = static_cast<DwtScaled&>(node);
+        using Stack = StackITimer<0u, value_type>;
+
+        // keep the same time left, flags untouched
+        const value_type iv = DwtScaleNode::scale(self.getInterval(), oldHz, newHz);
+        Stack&           st = self;
+        if constexpr (std::is_base_of_v<SlackDwtITimer<>, Timer>) {
+            // time left includes a nextWithSlack() stretch
+            const value_type left = DwtScaleNode::scale(self.timeLeft(now), oldHz, newHz);
+            st.Stack::next(now, iv);
+            self.expireIn(now, left);
+        } else {
+            const value_type left = DwtScaleNode::scale(st.timeLeft(now), oldHz, newHz);
+            st.Stack::next(static_cast<value_type>(now + left - iv), iv);
+        }
+    }
+};
+
+// interval ----------------------------
+using ScaledDwtITimer   = DwtScaled<SlackDwtITimer<>>;   // keeps a nextWithSlack() stretch across the change
+using ScaledOneShotIDwt = DwtScaled<OneShotIDwt<>>;
+
+#endif /* DWT_TIME_IS_EXISTS */
+#endif /* STM32_TOOLS_TIME_DWTCLOCK_H_ */
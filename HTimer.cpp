@@ -9,7 +9,7 @@
 
 #ifdef HAL_TIM_MODULE_ENABLED
 
-bool HTimer::attachTimer(TIM_HandleTypeDef *const htim)
+bool HTimer::attachTimer(TIM_HandleTypeDef *const htim, const u32 hz)
 {
     if (htim == nullptr || !IS_TIM_INSTANCE(htim->Instance)) {
         return false;
@@ -20,6 +20,7 @@ bool HTimer::attachTimer(TIM_HandleTypeDef *const htim)
     }
 
     _htim = htim;
+    _hz   = hz;
     timerStart();  // Start the timer when attached
     return true;
 }
@@ -9,6 +9,7 @@
 #define STM32_TOOLS_TIME_HTIMER_H_
 
 #include "interval_depency.h"
+#include <limits>
 
 #ifdef HAL_TIM_MODULE_ENABLED
 
@@ -23,7 +24,8 @@ public:
      */
 
     // Called once with htim — stores it and starts the timer
-    static bool attachTimer(TIM_HandleTypeDef* const htim);
+    // hz: counter rate (timer clock / (PSC + 1)), 0 if unknown
+    static bool attachTimer(TIM_HandleTypeDef* const htim, const u32 hz = 0);
 
     // Use this for all future calls (after the first one)
     static inline type_t now() noexcept { return _htim ? __HAL_TIM_GET_COUNTER(_htim) : 0; }
@@ -33,6 +35,16 @@ public:
      */
     inline static bool isAvailable() noexcept { return _htim != nullptr; }
 
+    /**
+     * @brief Attached timer handle (nullptr if none).
+     */
+    inline static TIM_HandleTypeDef* handle() noexcept { return _htim; }
+
+    /**
+     * @brief Counter rate given to attachTimer() (0 if unknown).
+     */
+    inline static u32 ticksPerSecond() noexcept { return _hz; }
+
 private:
     /**
      * @brief Starts the hardware timer.
@@ -54,6 +66,7 @@ private:
 
 private:
     static inline TIM_HandleTypeDef* _htim = nullptr; ///< Shared timer handle for all instances.
+    static inline u32 _hz = 0;                        ///< Counter rate, 0 = unknown.
 };
 
 
@@ -66,6 +79,11 @@ using HardITimer = ITimeBase<Interval, HTimer>;
 template<auto Interval = 0u>
 using OneShotIHtim = OneShotIBase<Interval, HTimer>;
 
+#include "interval/PackedOneShotIBase.h"
+template<auto Interval = 0u, typename Storage = HTimer::type_t,
+         PackedStore Store = PackedStore::LastTime>
+using PackedOneShotIHtim = PackedOneShotIBase<Interval, HTimer, Storage, Store>;
+
 // virtual ---------------------------------
 #include "virtual/VTimeBase.h"
 template<auto Interval = 0u>
@@ -74,6 +92,102 @@ using HardVTimer = VTimeBase<Interval, HTimer>;
 #include "virtual/OneShotVBase.h"
 template<auto Interval = 0u>
 using OneShotVHtim = OneShotVBase<Interval, HTimer>;
+
+// compare ---------------------------------
+
+/**
+ * @brief Output-compare channel of the attached timer, for CompareTimer/CompareQueue.
+ *
+ * Configure the channel as "Output Compare No Output" (TIM_OCMODE_TIMING), enable the
+ * timer's interrupt and forward the match:
+ *
+ *     void HAL_TIM_OC_DelayElapsedCallback(TIM_HandleTypeDef* htim) {
+ *         if (htim == HTimer::handle() && htim->Channel == HAL_TIM_ACTIVE_CHANNEL_1) {
+ *             HCompareQueue<TIM_CHANNEL_1>::onCompare();
+ *         }
+ *     }
+ *
+ * @tparam Channel TIM_CHANNEL_1..TIM_CHANNEL_4
+ * @tparam Mask    counter modulus - 1 (0xFFFF for 16-bit timers, 0xFFFFFFFF for TIM2/TIM5), ARR must equal Mask
+ */
+template<u32 Channel, HTimer::type_t Mask = 0xFFFFu>
+struct HTimerChannel {
+    static_assert(Channel == TIM_CHANNEL_1 || Channel == TIM_CHANNEL_2 ||
+                  Channel == TIM_CHANNEL_3 || Channel == TIM_CHANNEL_4,
+                  "HTimerChannel: Channel must be TIM_CHANNEL_1..4");
+
+    using type_t = HTimer::type_t;
+    static constexpr type_t mask = Mask;
+
+    static inline type_t now() noexcept { return HTimer::now(); }
+    static inline bool isAvailable() noexcept { return HTimer::isAvailable(); }
+
+    static inline void setCompare(const type_t v) noexcept {
+        __HAL_TIM_SET_COMPARE(HTimer::handle(), Channel, v);
+    }
+    static inline void enable() noexcept {
+        __HAL_TIM_ENABLE_IT(HTimer::handle(), TIM_DIER_CC1IE << (Channel >> 2u));
+    }
+    static inline void disable() noexcept {
+        __HAL_TIM_DISABLE_IT(HTimer::handle(), TIM_DIER_CC1IE << (Channel >> 2u));
+    }
+    static inline void trigger() noexcept {
+        HTimer::handle()->Instance->EGR = (TIM_EGR_CC1G << (Channel >> 2u));
+    }
+};
+
+#include "compare/CompareTimer.h"
+template<u32 Channel, HTimer::type_t Mask = 0xFFFFu>
+using OneShotCHtim = CompareTimer<HTimerChannel<Channel, Mask>>;
+
+template<u32 Channel, HTimer::type_t Mask = 0xFFFFu>
+using HCompareQueue = CompareQueue<HTimerChannel<Channel, Mask>>;
+
+// capture ---------------------------------
+
+/**
+ * @brief Input-capture channel of the attached timer with circular DMA, for CaptureMeter.
+ *
+ * Configure the channel as "Input Capture direct mode" with a DMA request on it:
+ * peripheral-to-memory, circular, data width = sizeof(Sample). No interrupt is needed.
+ *
+ *     HCaptureMeter<TIM_CHANNEL_1> tacho;
+ *     tacho.start();
+ *     ...
+ *     const u32 rpm = tacho.frequency(1'000'000) * 60 / pulsesPerRev;   // TIM at 1 MHz
+ *
+ * @tparam Channel TIM_CHANNEL_1..TIM_CHANNEL_4
+ * @tparam Sample  u16 for 16-bit timers, u32 for TIM2/TIM5
+ * @tparam Mask    counter modulus - 1, ARR must equal Mask
+ */
+template<u32 Channel, typename Sample = u16, Sample Mask = std::numeric_limits<Sample>::max()>
+struct HTimerCapture {
+    static_assert(Channel == TIM_CHANNEL_1 || Channel == TIM_CHANNEL_2 ||
+                  Channel == TIM_CHANNEL_3 || Channel == TIM_CHANNEL_4,
+                  "HTimerCapture: Channel must be TIM_CHANNEL_1..4");
+
+    using sample_t = Sample;
+    static constexpr sample_t mask = Mask;
+
+    static inline bool isAvailable() noexcept { return HTimer::isAvailable(); }
+
+    static inline bool start(sample_t* const buf, const u16 n) noexcept {
+        return HTimer::isAvailable() &&
+               HAL_TIM_IC_Start_DMA(HTimer::handle(), Channel, reinterpret_cast<u32*>(buf), n) == HAL_OK;
+    }
+    static inline void stop() noexcept {
+        if (HTimer::isAvailable()) {
+            HAL_TIM_IC_Stop_DMA(HTimer::handle(), Channel);
+        }
+    }
+    static inline u16 remaining() noexcept {
+        return static_cast<u16>(__HAL_DMA_GET_COUNTER(HTimer::handle()->hdma[TIM_DMA_ID_CC1 + (Channel >> 2u)]));
+    }
+};
+
+#include "capture/CaptureMeter.h"
+template<u32 Channel, u16 N = 32, u16 Window = 8, typename Sample = u16>
+using HCaptureMeter = CaptureMeter<HTimerCapture<Channel, Sample>, N, Window>;
 #else
 #warning "[Hardware TIME]: Hardware time is not enabled in this device"
 #endif /* HAL_TIM_MODULE_ENABLED */
@@ -0,0 +1,107 @@
+/*
+ * HostTick.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ */
+
+#include "HostTick.h"
+
+#ifdef TIME_HOST_BUILD
+
+#include "virtual/VTimer.h"
+#include <mutex>
+#include <thread>
+
+namespace {
+
+// Owns the driver thread; joins it at program exit if the user forgot stop()
+struct HostTickThread {
+    std::thread thread;
+    std::mutex  lock;   ///< start()/stop() from any thread, tick callbacks included
+
+    ~HostTickThread() {
+        HostTick::stop();
+        if (thread.joinable()) {
+            thread.join();   // stopped from its own callback earlier
+        }
+    }
+};
+
+HostTickThread& driver()
+{
+    static HostTickThread _driver;
+    return _driver;
+}
+
+// Threads are joined outside the lock: the one being joined may call stop()
+void retire(std::thread& t)
+{
+    if (!t.joinable()) {
+        return;
+    }
+    if (t.get_id() == std::this_thread::get_id()) {
+        t.detach();   // restarted from its own callback: it ends on return
+    } else {
+        t.join();
+    }
+}
+
+} /* namespace */
+
+bool HostTick::start(const std::chrono::microseconds period)
+{
+    if (period.count() <= 0) {
+        return false;
+    }
+
+    auto& _driver = driver();
+    std::thread old;
+    {
+        std::lock_guard<std::mutex> guard(_driver.lock);
+        if (_running.load(std::memory_order_acquire)) {
+            return true; // already running
+        }
+        // a driver stopped from its own callback is still joinable here
+        old = std::move(_driver.thread);
+
+        const u32 epoch = _epoch.fetch_add(1u, std::memory_order_acq_rel) + 1u;
+        _hz.store(static_cast<u32>(1'000'000 / period.count()), std::memory_order_relaxed);
+        _running.store(true, std::memory_order_release);
+        _driver.thread = std::thread(&HostTick::run, period, epoch);
+    }
+    retire(old);
+    return true;
+}
+
+void HostTick::stop()
+{
+    auto& _driver = driver();
+    std::thread old;
+    {
+        std::lock_guard<std::mutex> guard(_driver.lock);
+        _running.store(false, std::memory_order_release);
+        _epoch.fetch_add(1u, std::memory_order_acq_rel);
+        if (_driver.thread.get_id() != std::this_thread::get_id()) {
+            old = std::move(_driver.thread);
+        }
+    }
+    retire(old);
+}
+
+void HostTick::run(const std::chrono::microseconds period, const u32 epoch)
+{
+    // absolute schedule: a late wakeup delivers the missed ticks back-to-back,
+    // like a SysTick that was masked for a while
+    auto deadline = std::chrono::steady_clock::now();
+
+    while (_epoch.load(std::memory_order_acquire) == epoch) {
+        deadline += period;
+        std::this_thread::sleep_until(deadline);
+
+        _ticks.fetch_add(1, std::memory_order_relaxed);
+        HAL_SYSTICK_Callback();
+    }
+}
+
+#endif /* TIME_HOST_BUILD */
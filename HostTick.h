@@ -0,0 +1,81 @@
+/*
+ * HostTick.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ */
+
+#ifndef STM32_TOOLS_TIME_HOSTTICK_H_
+#define STM32_TOOLS_TIME_HOSTTICK_H_
+
+#include "interval_depency.h"
+
+#ifdef TIME_HOST_BUILD
+
+#include <atomic>
+
+struct SysTickDomain;
+
+//------------------------------------------------------------------------------
+// Host replacement for SysTick: a dedicated std::thread increments the tick
+// counter at a fixed rate and calls HAL_SYSTICK_Callback(), which services the
+// VTimer/AutoVTimer registries exactly like the SysTick ISR does on target.
+// Registry mutations are serialized with TimeLock (StdMutexLock by default).
+//------------------------------------------------------------------------------
+class HostTick
+{
+    STATIC_CLASS(HostTick);
+public:
+    using type_t = u32;
+    using tick_domain = SysTickDomain;   ///< now() counts the ticks VTimers count down
+
+    // Start the driver thread (no-op if already running)
+    static bool start(const std::chrono::microseconds period = 1ms);
+
+    // Stop and join the driver thread. From a tick callback the thread only
+    // ends after the callback returns; a later start() joins or detaches it.
+    static void stop();
+
+    [[nodiscard]] static bool isRunning() noexcept { return _running.load(std::memory_order_acquire); }
+
+    // Ticks delivered since start (same role as uwTick)
+    static inline type_t now() noexcept { return _ticks.load(std::memory_order_relaxed); }
+    static constexpr inline bool isAvailable() noexcept { return true; }
+
+    // Tick rate of the running driver (period given to start())
+    static inline u32 ticksPerSecond() noexcept { return _hz.load(std::memory_order_relaxed); }
+
+    // Add ticks that were not delivered one by one (simulated sleep, see LowPower.h)
+    static inline void advance(const type_t n) noexcept { _ticks.fetch_add(n, std::memory_order_relaxed); }
+
+private:
+    static void run(const std::chrono::microseconds period, const u32 epoch);
+
+private:
+    static inline std::atomic<type_t> _ticks{0};
+    static inline std::atomic<bool> _running{false};
+    static inline std::atomic<u32> _epoch{0};   ///< a driver runs while it matches its start()
+    static inline std::atomic<u32> _hz{1000};
+};
+
+// interval ----------------------------
+#include "interval/ITimeBase.h"
+template<auto Interval = 0u>
+using HostITimer = ITimeBase<Interval, HostTick>;
+
+#include "interval/OneShotIBase.h"
+template<auto Interval = 0u>
+using OneShotIHost = OneShotIBase<Interval, HostTick>;
+
+// virtual ---------------------------------
+#include "virtual/VTimeBase.h"
+template<auto Interval = 0u>
+using HostVTimer = VTimeBase<Interval, HostTick>;
+
+#include "virtual/OneShotVBase.h"
+template<auto Interval = 0u>
+using OneShotVHost = OneShotVBase<Interval, HostTick>;
+
+#endif /* TIME_HOST_BUILD */
+
+#endif /* STM32_TOOLS_TIME_HOSTTICK_H_ */
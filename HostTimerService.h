@@ -0,0 +1,703 @@
+/*
+ * HostTimerService.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Multi-threaded host timer service: sharded timer heaps + work-stealing callbacks
+ */
+
+#ifndef STM32_TOOLS_TIME_HOSTTIMERSERVICE_H_
+#define STM32_TOOLS_TIME_HOSTTIMERSERVICE_H_
+
+#include "interval_depency.h"
+
+#if defined(TIME_HOST_BUILD) && defined(__linux__)
+
+#include "LinuxClock.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <linux/futex.h>
+#include <sys/prctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+//------------------------------------------------------------------------------
+// HostTimerService<Policy>: thousands of callback timers over all cores.
+//
+//  - N threads, each one owns a shard (a deadline min-heap) and a work deque
+//  - arm()/cancel() from any thread are lock-free: arm pushes a request into
+//    the target shard's bounded MPSC inbox, cancel is one CAS on the timer's slot
+//  - a shard moves expired timers into its own deque; idle threads steal
+//    callbacks from the other deques (Chase-Lev), so one busy shard does not
+//    serialize its callbacks
+//  - a timer is bound to a service-owned slot on its first arm; requests name
+//    the slot and carry its generation, anything armed or cancelled since
+//    makes stale heap entries and queued callbacks fall through. Stale entries
+//    only ever touch the slot, never the HostTimer.
+//  - cancelSync() also waits for a callback that is already running (from
+//    inside the callback itself it does not wait), then unbinds the slot:
+//    the timer can be destroyed afterwards, even from its own callback
+//  - periodic timers are phase-locked (deadline += period), missed periods skipped
+//
+// Policy: a 64-bit LinuxClock policy (Monotonic by default), ticksPerSecond()
+// converts the sleep to nanoseconds. Idle shards sleep on a futex and are
+// woken only when a new deadline is earlier than the one they sleep for.
+//------------------------------------------------------------------------------
+
+class HostTimer;
+template<class Policy> class HostTimerService;
+
+namespace host_timer_detail {
+
+    inline void futexWait(std::atomic<u32>& word, const u32 expected, const u64 timeoutNs) noexcept {
+        timespec ts;
+        ts.tv_sec  = static_cast<time_t>(timeoutNs / 1'000'000'000ull);
+        ts.tv_nsec = static_cast<long>(timeoutNs % 1'000'000'000ull);
+        syscall(SYS_futex, reinterpret_cast<u32*>(&word), FUTEX_WAIT_PRIVATE, expected, &ts, nullptr, 0);
+    }
+
+    inline void futexWake(std::atomic<u32>& word) noexcept {
+        syscall(SYS_futex, reinterpret_cast<u32*>(&word), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+    }
+
+    //--------------------------------------------------------------------------
+    // Per-timer state owned by the service: outlives the HostTimer it served,
+    // so queued entries can always be checked against it
+    //--------------------------------------------------------------------------
+    struct TimerSlot {
+        std::atomic<u64>        gen{0};          ///< odd = armed; every arm/cancel/fire moves it on
+        std::atomic<u32>        running{0};      ///< callbacks in flight
+        std::atomic<u32>        nextFree{0};     ///< free-list link (index + 1, 0 = end)
+        std::atomic<HostTimer*> timer{nullptr};  ///< bound timer, read only while gen matches
+    };
+
+    //--------------------------------------------------------------------------
+    // Bounded multi-producer queue (Vyukov), consumed by the owning shard only
+    //--------------------------------------------------------------------------
+    template<class T>
+    class MpscRing
+    {
+    public:
+        explicit MpscRing(const u32 capacity)
+            : _mask(capacity - 1u), _cells(new Cell[capacity]) {
+            for (u32 i = 0; i < capacity; ++i) {
+                _cells[i].seq.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        _DELETE_COPY_MOVE(MpscRing);
+
+        bool push(const T& v) noexcept {
+            u64 pos = _tail.load(std::memory_order_relaxed);
+            for (;;) {
+                Cell& c = _cells[pos & _mask];
+                const u64 seq = c.seq.load(std::memory_order_acquire);
+                const i64 dif = static_cast<i64>(seq) - static_cast<i64>(pos);
+                if (dif == 0) {
+                    if (_tail.compare_exchange_weak(pos, pos + 1u, std::memory_order_relaxed)) {
+                        c.value = v;
+                        c.seq.store(pos + 1u, std::memory_order_release);
+                        return true;
+                    }
+                } else if (dif < 0) {
+                    return false;   // full
+                } else {
+                    pos = _tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool pop(T& out) noexcept {
+            Cell& c = _cells[_head & _mask];
+            if (c.seq.load(std::memory_order_acquire) != _head + 1u) {
+                return false;
+            }
+            out = c.value;
+            c.seq.store(_head + _mask + 1u, std::memory_order_release);
+            ++_head;
+            return true;
+        }
+
+    private:
+        struct Cell {
+            std::atomic<u64> seq;
+            T value;
+        };
+
+        const u64 _mask;
+        std::unique_ptr<Cell[]> _cells;
+        alignas(64) std::atomic<u64> _tail{0};
+        alignas(64) u64 _head = 0;
+    };
+
+    //--------------------------------------------------------------------------
+    // Fixed-capacity Chase-Lev work-stealing deque (Le et al., C11 version).
+    // Owner: push/pop at the bottom, thieves: steal at the top. A slot is only
+    // reused once it is out of [top, bottom), so a torn read by a thief is
+    // always followed by a failed CAS.
+    //--------------------------------------------------------------------------
+    template<class T>
+    class WorkDeque
+    {
+    public:
+        explicit WorkDeque(const u32 capacity) : _mask(capacity - 1u), _slots(new Slot[capacity]) {}
+
+        _DELETE_COPY_MOVE(WorkDeque);
+
+        bool push(const T& v) noexcept {
+            const i64 b = _bottom.load(std::memory_order_relaxed);
+            const i64 t = _top.load(std::memory_order_acquire);
+            if (b - t > static_cast<i64>(_mask)) {
+                return false;   // full: caller runs the job inline
+            }
+            _slots[b & _mask].store(v);
+            std::atomic_thread_fence(std::memory_order_release);
+            _bottom.store(b + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        bool pop(T& out) noexcept {
+            const i64 b = _bottom.load(std::memory_order_relaxed) - 1;
+            _bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            i64 t = _top.load(std::memory_order_relaxed);
+
+            if (t > b) {
+                _bottom.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+            out = _slots[b & _mask].load();
+            if (t == b) {   // last element: race the thieves for it
+                const bool won = _top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                              std::memory_order_relaxed);
+                _bottom.store(b + 1, std::memory_order_relaxed);
+                return won;
+            }
+            return true;
+        }
+
+        bool steal(T& out) noexcept {
+            i64 t = _top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const i64 b = _bottom.load(std::memory_order_acquire);
+            if (t >= b) {
+                return false;
+            }
+            out = _slots[t & _mask].load();
+            return _top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] bool empty() const noexcept {
+            return _top.load(std::memory_order_relaxed) >= _bottom.load(std::memory_order_relaxed);
+        }
+
+    private:
+        // T as relaxed atomic words: thieves may read a slot the owner rewrites
+        struct Slot {
+            static_assert(sizeof(T) % sizeof(u64) == 0, "WorkDeque: T must be a whole number of words");
+            static constexpr u32 words = sizeof(T) / sizeof(u64);
+            std::atomic<u64> w[words];
+
+            void store(const T& v) noexcept {
+                u64 tmp[words];
+                std::memcpy(tmp, &v, sizeof(T));
+                for (u32 i = 0; i < words; ++i) {
+                    w[i].store(tmp[i], std::memory_order_relaxed);
+                }
+            }
+            T load() const noexcept {
+                u64 tmp[words];
+                for (u32 i = 0; i < words; ++i) {
+                    tmp[i] = w[i].load(std::memory_order_relaxed);
+                }
+                T v;
+                std::memcpy(&v, tmp, sizeof(T));
+                return v;
+            }
+        };
+
+        const u64 _mask;
+        std::unique_ptr<Slot[]> _slots;
+        alignas(64) std::atomic<i64> _top{0};
+        alignas(64) std::atomic<i64> _bottom{0};
+    };
+
+} /* namespace host_timer_detail */
+
+//------------------------------------------------------------------------------
+// HostTimer: user-owned node. Not copyable; cancelSync() it before destroying,
+// and before destroying the service it was armed on.
+//------------------------------------------------------------------------------
+class HostTimer
+{
+    template<class> friend class HostTimerService;
+
+public:
+    using Callback = void (*)(HostTimer&);
+
+    explicit HostTimer(const Callback cb = nullptr, void* const user = nullptr) noexcept
+        : _callback(cb), _user(user) {}
+
+    _DELETE_COPY_MOVE(HostTimer);
+
+    // Armed and not yet fired (one-shot) / not cancelled (periodic)
+    [[nodiscard]] bool isArmed() const noexcept {
+        const host_timer_detail::TimerSlot* const slot = _slot.load(std::memory_order_acquire);
+        return slot != nullptr && (slot->gen.load(std::memory_order_acquire) & 1u) != 0u;
+    }
+
+    // Callbacks started so far
+    [[nodiscard]] u64 fired() const noexcept { return _fired.load(std::memory_order_relaxed); }
+
+    // Deadline of the callback that ran last (valid inside the callback)
+    [[nodiscard]] u64 deadline() const noexcept { return _deadline.load(std::memory_order_relaxed); }
+
+    [[nodiscard]] void* user() const noexcept { return _user; }
+    void setCallback(const Callback cb) noexcept { _callback = cb; }
+
+private:
+    std::atomic<host_timer_detail::TimerSlot*> _slot{nullptr};   ///< bound by the first arm
+    std::atomic<u64> _fired{0};
+    std::atomic<u64> _deadline{0};
+    Callback         _callback;
+    void*            _user;
+};
+
+template<class Policy = Monotonic>
+class HostTimerService
+{
+public:
+    using value_type = typename Policy::type_t;
+
+    static_assert(std::is_same_v<value_type, u64>, "HostTimerService: Policy::type_t must be u64");
+
+    struct Stats {
+        u64 fired  = 0;   ///< callbacks run
+        u64 stolen = 0;   ///< callbacks run by a thread other than the expiring shard
+        u64 stale  = 0;   ///< entries dropped because the timer was re-armed/cancelled
+    };
+
+    /**
+     * @param threads   worker/shard count (0 = hardware concurrency)
+     * @param inbox     per-shard arm request capacity (power of two)
+     * @param deque     per-thread callback queue capacity (power of two)
+     * @param timers    timers bound at the same time (armed and not cancelSync()ed)
+     */
+    explicit HostTimerService(unsigned threads = 0, const u32 inbox = 1u << 14, const u32 deque = 1u << 12,
+                              const u32 timers = 1u << 16)
+        : _slots(new Slot[timers]), _slotCount(timers) {
+        if (threads == 0u) {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        _shards.reserve(threads);
+        for (unsigned i = 0; i < threads; ++i) {
+            _shards.emplace_back(std::make_unique<Shard>(roundPow2(inbox), roundPow2(deque)));
+        }
+        for (u32 i = 0; i < timers; ++i) {
+            _slots[i].nextFree.store((i + 1u < timers) ? i + 2u : 0u, std::memory_order_relaxed);
+        }
+        _free.store((timers != 0u) ? 1u : 0u, std::memory_order_relaxed);
+    }
+
+    // Timers still bound are unbound (they must outlive this call)
+    ~HostTimerService() {
+        stop();
+        for (u32 i = 0; i < _slotCount; ++i) {
+            if (HostTimer* const t = _slots[i].timer.load(std::memory_order_acquire)) {
+                t->_slot.store(nullptr, std::memory_order_release);
+            }
+        }
+    }
+
+    _DELETE_COPY_MOVE(HostTimerService);
+
+    bool start() {
+        bool expected = false;
+        if (!_running.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            return false;
+        }
+        for (u32 i = 0; i < _shards.size(); ++i) {
+            _shards[i]->thread = std::thread(&HostTimerService::run, this, i);
+        }
+        return true;
+    }
+
+    // Stop and join all threads; pending timers stay armed but never fire
+    void stop() {
+        if (!_running.exchange(false, std::memory_order_acq_rel)) {
+            return;
+        }
+        for (auto& s : _shards) {
+            wake(*s);
+        }
+        for (auto& s : _shards) {
+            if (s->thread.joinable()) {
+                s->thread.join();
+            }
+        }
+    }
+
+    // (Re-)arm: first callback `delay` ticks from now, then every `period` (0 = one-shot)
+    bool arm(HostTimer& t, const value_type delay, const value_type period = 0) {
+        return armAt(t, Policy::now() + delay, period);
+    }
+
+    /**
+     * @brief (Re-)arm against an absolute deadline.
+     * @return false if no slot is free (`timers` bound) or t is bound to another service.
+     */
+    bool armAt(HostTimer& t, const value_type deadline, const value_type period = 0) {
+        Slot* const slot = bind(t);
+        if (slot == nullptr) {
+            return false;
+        }
+        u64 g = slot->gen.load(std::memory_order_relaxed);
+        u64 next;
+        do {
+            next = (g & 1u) ? g + 2u : g + 1u;   // always a new odd generation
+        } while (!slot->gen.compare_exchange_weak(g, next, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+        return post(Entry{deadline, period, next, index(slot)});
+    }
+
+    /**
+     * @brief Cancel without waiting. A callback already running finishes,
+     *        a periodic timer is not re-armed after it.
+     * @return true if the timer was armed.
+     */
+    bool cancel(HostTimer& t) noexcept {
+        Slot* const slot = owned(t);
+        if (slot == nullptr) {
+            return false;
+        }
+        u64 g = slot->gen.load(std::memory_order_relaxed);
+        while (g & 1u) {
+            if (slot->gen.compare_exchange_weak(g, g + 1u, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Cancel, wait until no callback of t is running, unbind t.
+     *
+     * Entries still queued for t name its old slot generation and are dropped
+     * without touching t, so t can be destroyed afterwards (also from its own
+     * callback). Must not race other calls on the same timer.
+     */
+    bool cancelSync(HostTimer& t) noexcept {
+        Slot* const slot = owned(t);
+        if (slot == nullptr) {
+            return false;
+        }
+        const u32 self = (_current == &t) ? 1u : 0u;   // called from t's own callback
+        bool was = false;
+        do {
+            // a callback still running may re-arm t: cancel again until it stays off
+            was = cancel(t) || was;
+            while (slot->running.load(std::memory_order_seq_cst) > self) {
+                std::this_thread::yield();
+            }
+        } while (slot->gen.load(std::memory_order_seq_cst) & 1u);
+        unbind(t, slot);
+        return was;
+    }
+
+    [[nodiscard]] Stats stats() const noexcept {
+        Stats s;
+        for (const auto& sh : _shards) {
+            s.fired  += sh->fired.load(std::memory_order_relaxed);
+            s.stolen += sh->stolen.load(std::memory_order_relaxed);
+            s.stale  += sh->stale.load(std::memory_order_relaxed);
+        }
+        return s;
+    }
+
+    [[nodiscard]] u32 threads() const noexcept { return static_cast<u32>(_shards.size()); }
+    [[nodiscard]] bool isRunning() const noexcept { return _running.load(std::memory_order_acquire); }
+
+private:
+    using Slot = host_timer_detail::TimerSlot;
+
+    struct Entry {
+        u64 deadline;
+        u64 period;
+        u64 gen;
+        u32 slot;
+    };
+
+    struct Shard {
+        Shard(const u32 inbox, const u32 deque) : requests(inbox), work(deque) {}
+
+        host_timer_detail::MpscRing<Entry>   requests;
+        host_timer_detail::WorkDeque<Entry>  work;
+        std::vector<Entry>                   heap;      ///< min-heap by deadline, owner only
+        alignas(64) std::atomic<u32>         epoch{0};  ///< futex word
+        std::atomic<u64>                     sleepUntil{0};   ///< 0 = awake, else sleeping until
+        std::atomic<u64>                     fired{0};
+        std::atomic<u64>                     stolen{0};
+        std::atomic<u64>                     stale{0};
+        std::thread                          thread;
+    };
+
+    static constexpr u64 never = ~u64{0};
+
+    static u32 roundPow2(u32 v) noexcept {
+        u32 p = 2u;
+        while (p < v) {
+            p <<= 1u;
+        }
+        return p;
+    }
+
+    static bool later(const Entry& a, const Entry& b) noexcept { return a.deadline > b.deadline; }
+
+    [[nodiscard]] u32 index(const Slot* const slot) const noexcept { return static_cast<u32>(slot - _slots.get()); }
+
+    // t's slot if it is bound to this service
+    [[nodiscard]] Slot* owned(const HostTimer& t) const noexcept {
+        Slot* const slot = t._slot.load(std::memory_order_acquire);
+        return (slot >= _slots.get() && slot < _slots.get() + _slotCount) ? slot : nullptr;
+    }
+
+    // t's slot, bound on the first arm (lock-free free list, tagged against ABA)
+    Slot* bind(HostTimer& t) noexcept {
+        Slot* slot = t._slot.load(std::memory_order_acquire);
+        if (slot != nullptr) {
+            return owned(t);
+        }
+        u64 head = _free.load(std::memory_order_acquire);
+        for (;;) {
+            const u32 top = static_cast<u32>(head);
+            if (top == 0u) {
+                return nullptr;   // all slots bound
+            }
+            const u64 next = ((head >> 32) + 1u) << 32 | _slots[top - 1u].nextFree.load(std::memory_order_relaxed);
+            if (_free.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                slot = &_slots[top - 1u];
+                break;
+            }
+        }
+        slot->timer.store(&t, std::memory_order_release);
+        Slot* expected = nullptr;
+        if (!t._slot.compare_exchange_strong(expected, slot, std::memory_order_acq_rel)) {
+            release(slot);        // a concurrent first arm won
+            return owned(t);
+        }
+        return slot;
+    }
+
+    void unbind(HostTimer& t, Slot* const slot) noexcept {
+        t._slot.store(nullptr, std::memory_order_release);
+        release(slot);
+    }
+
+    // Back on the free list; its generation keeps counting, old entries stay stale
+    void release(Slot* const slot) noexcept {
+        slot->timer.store(nullptr, std::memory_order_relaxed);
+        const u32 id = index(slot) + 1u;
+        u64 head = _free.load(std::memory_order_relaxed);
+        do {
+            slot->nextFree.store(static_cast<u32>(head), std::memory_order_relaxed);
+        } while (!_free.compare_exchange_weak(head, ((head >> 32) + 1u) << 32 | id,
+                                              std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    // Route to the calling service thread's own shard, round-robin otherwise
+    bool post(const Entry& e) {
+        if (_self != nullptr && _owner == this) {
+            pushHeap(*_self, e);
+            return true;
+        }
+        Shard& s = *_shards[_rr.fetch_add(1u, std::memory_order_relaxed) % _shards.size()];
+        while (!s.requests.push(e)) {
+            wake(s);                    // full: let the shard drain it
+            std::this_thread::yield();
+        }
+        // pairs with the fence in run(): either the shard sees the request
+        // before sleeping, or we see it asleep and wake it
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (e.deadline < s.sleepUntil.load(std::memory_order_relaxed)) {
+            wake(s);
+        }
+        return true;
+    }
+
+    static void pushHeap(Shard& s, const Entry& e) {
+        s.heap.push_back(e);
+        std::push_heap(s.heap.begin(), s.heap.end(), later);
+    }
+
+    static void wake(Shard& s) noexcept {
+        s.epoch.fetch_add(1u, std::memory_order_seq_cst);
+        host_timer_detail::futexWake(s.epoch);
+    }
+
+    void run(const u32 index) {
+        Shard& s = *_shards[index];
+        _self  = &s;
+        _owner = this;
+
+        // default 50 us timer slack would dominate the wakeup latency
+        prctl(PR_SET_TIMERSLACK, 1ul, 0ul, 0ul, 0ul);
+
+        while (_running.load(std::memory_order_acquire)) {
+            const u32 epoch = s.epoch.load(std::memory_order_seq_cst);
+
+            Entry e;
+            while (s.requests.pop(e)) {
+                pushHeap(s, e);
+            }
+
+            // expired -> own deque (run inline if it is full)
+            const u64 now = Policy::now();
+            u32 queued = 0;
+            while (!s.heap.empty() && s.heap.front().deadline <= now) {
+                std::pop_heap(s.heap.begin(), s.heap.end(), later);
+                e = s.heap.back();
+                s.heap.pop_back();
+                if (_slots[e.slot].gen.load(std::memory_order_acquire) != e.gen) {
+                    s.stale.fetch_add(1u, std::memory_order_relaxed);
+                    continue;
+                }
+                if (s.work.push(e)) {
+                    ++queued;
+                } else {
+                    execute(s, e, false);
+                }
+            }
+
+            // more than one callback: wake sleeping peers to steal the rest
+            for (u32 k = 1; k < _shards.size() && queued > 1u; ++k) {
+                Shard& peer = *_shards[(index + k) % _shards.size()];
+                if (peer.sleepUntil.load(std::memory_order_relaxed) != 0u) {
+                    wake(peer);
+                    --queued;
+                }
+            }
+
+            // own callbacks first, then help the others
+            bool worked = false;
+            while (s.work.pop(e)) {
+                execute(s, e, false);
+                worked = true;
+            }
+            for (u32 k = 1; k < _shards.size() && !worked; ++k) {
+                Shard& victim = *_shards[(index + k) % _shards.size()];
+                while (victim.work.steal(e)) {
+                    execute(s, e, true);
+                    worked = true;
+                }
+            }
+            if (worked) {
+                continue;
+            }
+
+            // sleep until the next deadline or a wake() with an earlier one
+            const u64 until = s.heap.empty() ? never : s.heap.front().deadline;
+            s.sleepUntil.store(until, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!s.requests.pop(e)) {
+                const u64 now2 = Policy::now();
+                if (until > now2) {
+                    const u64 ticks = (until == never) ? Policy::ticksPerSecond() : until - now2;
+                    if (ticks > spinTicks()) {
+                        futexWait(s, epoch, ticks);
+                    } else {
+                        std::this_thread::yield();   // closer than a futex round trip
+                    }
+                }
+            } else {
+                pushHeap(s, e);
+            }
+            s.sleepUntil.store(0, std::memory_order_relaxed);
+        }
+
+        _self  = nullptr;
+        _owner = nullptr;
+    }
+
+    // 20 us: below that a futex sleep overshoots more than it saves
+    static u64 spinTicks() noexcept {
+        static const u64 ticks = Policy::ticksPerSecond() / 50'000u;
+        return ticks;
+    }
+
+    static void futexWait(Shard& s, const u32 epoch, const u64 ticks) noexcept {
+        const u64 tps = Policy::ticksPerSecond();
+        const u64 ns  = (tps == 1'000'000'000ull) ? ticks
+                      : linux_clock_detail::mul_div(ticks, 1'000'000'000ull, tps, 0u);
+        // peers are woken to steal, the cap only bounds a missed steal opportunity
+        host_timer_detail::futexWait(s.epoch, epoch, std::min<u64>(ns, 1'000'000ull));
+    }
+
+    void execute(Shard& s, const Entry& e, const bool stolen) {
+        Slot& slot = _slots[e.slot];
+
+        // Dekker with cancelSync(): running++ then gen check vs. gen change then running check
+        slot.running.fetch_add(1u, std::memory_order_seq_cst);
+        bool run;
+        if (e.period == 0u) {
+            u64 g = e.gen;
+            run = slot.gen.compare_exchange_strong(g, e.gen + 1u, std::memory_order_seq_cst);   // one-shot: disarm
+        } else {
+            run = (slot.gen.load(std::memory_order_seq_cst) == e.gen);
+        }
+
+        if (run) {
+            // t is alive until the callback returns; it may cancelSync() and
+            // destroy itself there, so nothing below the call touches it
+            HostTimer& t = *slot.timer.load(std::memory_order_acquire);
+            t._deadline.store(e.deadline, std::memory_order_relaxed);
+            t._fired.fetch_add(1u, std::memory_order_relaxed);
+            s.fired.fetch_add(1u, std::memory_order_relaxed);
+            if (stolen) {
+                s.stolen.fetch_add(1u, std::memory_order_relaxed);
+            }
+            const HostTimer::Callback cb = t._callback;
+            HostTimer* const prev = _current;
+            _current = &t;
+            if (cb) {
+                cb(t);
+            }
+            _current = prev;
+
+            if (e.period != 0u && slot.gen.load(std::memory_order_acquire) == e.gen) {
+                // phase-locked, missed periods skipped
+                const u64 now  = Policy::now();
+                u64       next = e.deadline + e.period;
+                if (next <= now) {
+                    next += ((now - next) / e.period + 1u) * e.period;
+                }
+                pushHeap(s, Entry{next, e.period, e.gen, e.slot});
+            }
+        } else {
+            s.stale.fetch_add(1u, std::memory_order_relaxed);
+        }
+        slot.running.fetch_sub(1u, std::memory_order_seq_cst);
+    }
+
+private:
+    std::vector<std::unique_ptr<Shard>> _shards;
+    std::unique_ptr<Slot[]> _slots;
+    const u32               _slotCount;
+    std::atomic<u64>        _free{0};    ///< free-list head: ABA tag << 32 | (index + 1)
+    std::atomic<bool> _running{false};
+    std::atomic<u32>  _rr{0};
+
+    static inline thread_local Shard*            _self    = nullptr;
+    static inline thread_local HostTimerService* _owner   = nullptr;
+    static inline thread_local HostTimer*        _current = nullptr;
+};
+
+#endif /* TIME_HOST_BUILD && __linux__ */
+
+#endif /* STM32_TOOLS_TIME_HOSTTIMERSERVICE_H_ */
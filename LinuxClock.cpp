@@ -0,0 +1,75 @@
+/*
+ * LinuxClock.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ */
+
+#include "LinuxClock.h"
+
+#if defined(__linux__) && (defined(__x86_64__) || defined(__i386__))
+
+#include <cpuid.h>
+
+bool Tsc::isAvailable() noexcept
+{
+    static const bool _invariant = [] {
+        unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+        if (__get_cpuid_max(0x80000000u, nullptr) < 0x80000007u) {
+            return false;
+        }
+        __cpuid(0x80000007u, eax, ebx, ecx, edx);
+        return (edx & (1u << 8)) != 0u; // invariant TSC
+    }();
+    return _invariant;
+}
+
+u64 Tsc::ticksPerSecond() noexcept
+{
+    static const u64 _hz = calibrate();
+    return _hz;
+}
+
+/**
+ * @brief Measures the TSC rate against CLOCK_MONOTONIC_RAW.
+ *
+ * Each edge is sampled between two rdtsc reads and the tightest bracket of
+ * a few tries is kept, so a preemption during a clock read doesn't skew it.
+ */
+u64 Tsc::calibrate() noexcept
+{
+    constexpr u64 window_ns = 20'000'000ull; // 20 ms: ~1e-5 relative error
+    constexpr int tries     = 5;
+
+    auto sample = [](u64& tsc, u64& ns) {
+        u64 best = ~0ull;
+        for (int i = 0; i < tries; ++i) {
+            const u64 t0 = __rdtsc();
+            const u64 n  = MonotonicRaw::now();
+            const u64 t1 = __rdtsc();
+            if ((t1 - t0) < best) {
+                best = t1 - t0;
+                tsc  = t0 + (t1 - t0) / 2u;
+                ns   = n;
+            }
+        }
+    };
+
+    u64 tsc0 = 0, ns0 = 0, tsc1 = 0, ns1 = 0;
+    sample(tsc0, ns0);
+
+    const u64 until = ns0 + window_ns;
+    while (MonotonicRaw::now() < until) {
+        // busy wait: sleeping would let the core change P-state mid-window
+    }
+
+    sample(tsc1, ns1);
+
+    const u64 dns = ns1 - ns0;
+    if (dns == 0u) {
+        return 0u;
+    }
+    return linux_clock_detail::mul_div(tsc1 - tsc0, 1'000'000'000ull, dns, dns / 2u);   // rounded
+}
+
+#endif /* linux && x86 */
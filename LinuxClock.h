@@ -0,0 +1,185 @@
+/*
+ * LinuxClock.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ */
+
+#ifndef STM32_TOOLS_TIME_LINUXCLOCK_H_
+#define STM32_TOOLS_TIME_LINUXCLOCK_H_
+
+#include "interval_depency.h"
+
+#if !defined(__linux__)
+#warning "[LINUX TIME]: Linux clocks are not supported on this target."
+#else
+
+#define LINUX_TIME_IS_EXISTS 1
+
+#include <time.h>
+
+//------------------------------------------------------------------------------
+// Host clock policies with the same contract as Tick/Dwt/HTimer:
+//   type_t, static now() noexcept, static isAvailable()
+//
+// All of them are 64-bit: a 32-bit nanosecond counter wraps every 4.3 s.
+//------------------------------------------------------------------------------
+
+namespace linux_clock_detail {
+    inline u64 read(const clockid_t id) noexcept {
+        timespec ts;
+        clock_gettime(id, &ts);
+        return static_cast<u64>(ts.tv_sec) * 1'000'000'000ull + static_cast<u64>(ts.tv_nsec);
+    }
+
+    inline bool probe(const clockid_t id) noexcept {
+        timespec ts;
+        return clock_getres(id, &ts) == 0;
+    }
+
+    // a * b / c + (round / c), no 128-bit type (not on i386): with
+    // a = q * c + r it is q * b + (r * b + round) / c, exact while r * b
+    // fits 64 bits, i.e. b and c below ~4e9 (GHz-range rates, ns windows)
+    inline u64 mul_div(const u64 a, const u64 b, const u64 c, const u64 round) noexcept {
+        const u64 q = a / c;
+        const u64 r = a % c;
+        return q * b + (r * b + round) / c;
+    }
+} /* namespace linux_clock_detail */
+
+/**
+ * @brief CLOCK_MONOTONIC in nanoseconds. Served from the vDSO (no syscall),
+ *        slewed by NTP.
+ */
+class Monotonic
+{
+    STATIC_CLASS(Monotonic);
+public:
+    using type_t = u64;
+
+    static inline type_t now() noexcept { return linux_clock_detail::read(CLOCK_MONOTONIC); }
+    static inline bool isAvailable() noexcept { return linux_clock_detail::probe(CLOCK_MONOTONIC); }
+
+    static constexpr type_t ticksPerSecond() noexcept { return 1'000'000'000ull; }
+};
+
+/**
+ * @brief CLOCK_MONOTONIC_RAW in nanoseconds. Not slewed by NTP; vDSO on
+ *        kernels >= 5.3, a real syscall on older ones.
+ */
+class MonotonicRaw
+{
+    STATIC_CLASS(MonotonicRaw);
+public:
+    using type_t = u64;
+
+    static inline type_t now() noexcept { return linux_clock_detail::read(CLOCK_MONOTONIC_RAW); }
+    static inline bool isAvailable() noexcept { return linux_clock_detail::probe(CLOCK_MONOTONIC_RAW); }
+
+    static constexpr type_t ticksPerSecond() noexcept { return 1'000'000'000ull; }
+};
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#define TSC_TIME_IS_EXISTS 1
+
+#include <x86intrin.h>
+
+/**
+ * @brief Raw time-stamp counter. now() is a single rdtsc.
+ *
+ * isAvailable() is true only for an invariant TSC (constant rate across
+ * P-/C-states), otherwise cycles don't map to wall time.
+ */
+class Tsc
+{
+    STATIC_CLASS(Tsc);
+public:
+    using type_t = u64;
+
+    // Return current TSC value (no serialization, no calibration on this path)
+    static inline type_t now() noexcept { return __rdtsc(); }
+
+    // Invariant TSC present (CPUID.80000007H:EDX[8]), checked once
+    static bool isAvailable() noexcept;
+
+    // TSC frequency in Hz, calibrated once against CLOCK_MONOTONIC_RAW on first call.
+    // Call once at startup to keep the calibration out of timing-critical code.
+    static u64 ticksPerSecond() noexcept;
+
+private:
+    static u64 calibrate() noexcept;
+};
+
+/**
+ * @brief Helper class to calculate TSC ticks from time based on the calibrated frequency.
+ */
+class TscBuilder {
+    STATIC_CLASS(TscBuilder);
+public:
+    using type_t = Tsc::type_t;
+
+    /**
+     * @brief Converts nanoseconds to TSC ticks.
+     * @param ns Time in nanoseconds.
+     * @return TSC ticks (rounded up).
+     */
+    static inline type_t from_nano(const u64 ns) noexcept {
+        return mul_div_up(ns, Tsc::ticksPerSecond(), 1'000'000'000ull);
+    }
+
+    /**
+     * @brief Converts microseconds to TSC ticks.
+     * @param us Time in microseconds.
+     * @return TSC ticks (rounded up).
+     */
+    static inline type_t from_micro(const u64 us) noexcept {
+        return mul_div_up(us, Tsc::ticksPerSecond(), 1'000'000ull);
+    }
+
+    /**
+     * @brief Converts milliseconds to TSC ticks.
+     * @param ms Time in milliseconds.
+     * @return TSC ticks (rounded up).
+     */
+    static inline type_t from_milli(const u64 ms) noexcept {
+        return mul_div_up(ms, Tsc::ticksPerSecond(), 1'000ull);
+    }
+
+    template<typename Rep, typename Period>
+    static inline type_t from(const std::chrono::duration<Rep, Period> d) noexcept {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+        return from_nano(static_cast<u64>(ns));
+    }
+
+private:
+    // split multiply: ns * GHz-range frequencies overflows u64 after ~5 s
+    static inline u64 mul_div_up(const u64 v, const u64 mul, const u64 div) noexcept {
+        return linux_clock_detail::mul_div(v, mul, div, div - 1u);
+    }
+};
+
+#endif /* x86 */
+
+// interval ----------------------------
+#include "interval/ITimeBase.h"
+template<auto Interval = 0ull>
+using MonoITimer = ITimeBase<Interval, Monotonic>;
+template<auto Interval = 0ull>
+using MonoRawITimer = ITimeBase<Interval, MonotonicRaw>;
+
+#include "interval/OneShotIBase.h"
+template<auto Interval = 0ull>
+using OneShotIMono = OneShotIBase<Interval, Monotonic>;
+template<auto Interval = 0ull>
+using OneShotIMonoRaw = OneShotIBase<Interval, MonotonicRaw>;
+
+#ifdef TSC_TIME_IS_EXISTS
+template<auto Interval = 0ull>
+using TscITimer = ITimeBase<Interval, Tsc>;
+template<auto Interval = 0ull>
+using OneShotITsc = OneShotIBase<Interval, Tsc>;
+#endif /* TSC_TIME_IS_EXISTS */
+
+#endif /* __linux__ */
+#endif /* STM32_TOOLS_TIME_LINUXCLOCK_H_ */
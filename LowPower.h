@@ -0,0 +1,220 @@
+/*
+ * LowPower.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * STOP-mode time compensation: Tick and the VTimer registries catch up after wake
+ */
+
+#ifndef STM32_TOOLS_TIME_LOWPOWER_H_
+#define STM32_TOOLS_TIME_LOWPOWER_H_
+
+#include "interval_depency.h"
+#include "lock_policy.h"
+#include "virtual/VTimer.h"
+#include "virtual/AutoVTimer.h"
+#include <limits>
+#include <type_traits>
+
+#ifndef TIME_HOST_BUILD
+#include "Tick.h"
+#else
+#include "HostTick.h"
+#include <atomic>
+#endif
+
+//------------------------------------------------------------------------------
+// StopCompensation<LpClock, TickHz>
+//  - SysTick halts in STOP: uwTick, every Tick-based deadline and every VTimer
+//    counter freeze for the whole sleep
+//  - enter() stamps a clock that keeps running in STOP (LPTIM/RTC on LSE),
+//    exit() converts the slept time into SysTick ticks and applies them once:
+//      Tick        += n
+//      VTimer      counters -n, the ones that ran out are expired
+//      AutoVTimer  every period that ended during the sleep is pending
+//    one pass per registry, no per-timer fixups
+//  - the sub-tick remainder of each sleep is carried over, so repeated short
+//    sleeps do not lose time
+//
+// LpClock policy: type_t (unsigned), now(), ticksPerSecond(), optional `mask`
+// (counter modulus - 1, e.g. 0xFFFF for LPTIM). One sleep must be shorter than
+// one counter wrap (LPTIM at 32768 Hz / 128 prescaler: 256 s).
+//
+//     using Stop = StopCompensation<LptimClock>;
+//     Stop::enter();
+//     HAL_SuspendTick();
+//     HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI);
+//     SystemClock_Config();
+//     Stop::exit();              // before HAL_ResumeTick(): no tick in between
+//     HAL_ResumeTick();
+//
+// Other tick domains (BasicVTimer<Domain>) stop with their timers too;
+// advance them with BasicVTimer<Domain>::advance(n) if they must catch up.
+//------------------------------------------------------------------------------
+template<class LpClock, u32 TickHz = 1000u>
+class StopCompensation
+{
+    STATIC_CLASS(StopCompensation);
+
+public:
+    using lp_type = typename LpClock::type_t;
+    using value_type = VTimer::value_type;
+
+    static_assert(std::is_unsigned_v<lp_type>, "StopCompensation: LpClock::type_t must be unsigned");
+    static_assert(TickHz > 0u, "StopCompensation: TickHz must be non-zero");
+
+    // Before entering STOP
+    static void enter() noexcept(noexcept(LpClock::now())) { _t0 = LpClock::now(); }
+
+    /**
+     * @brief After wake: applies the slept time.
+     * @return SysTick ticks applied.
+     */
+    static value_type exit() {
+        const lp_type lp = static_cast<lp_type>((LpClock::now() - _t0) & mask());
+        _lastSleep = lp;
+
+        // SysTick ticks = lp * TickHz / lpHz, remainder kept for the next sleep
+        const u64 hz  = static_cast<u64>(LpClock::ticksPerSecond());
+        const u64 acc = static_cast<u64>(lp) * TickHz + _frac;
+        const value_type n = hz ? static_cast<value_type>(acc / hz) : value_type{0};
+        _frac = hz ? (acc % hz) : 0u;
+
+        advance(n);
+        return n;
+    }
+
+    // enter(), fn() (the STOP entry), exit()
+    template<class Fn>
+    static value_type sleep(Fn&& fn) {
+        enter();
+        fn();
+        return exit();
+    }
+
+    /**
+     * @brief Applies @p n SysTick ticks to Tick and both SysTick registries.
+     *
+     * Also usable on its own, e.g. when the sleep length is known from the
+     * wakeup timer reload instead of a running clock.
+     */
+    static void advance(const value_type n) {
+        if (n == 0u) {
+            return;
+        }
+        advanceTick(n);
+        VTimer::advance(n);
+        AutoVTimer::advance(n);
+        _total = _total + n;
+    }
+
+    // LpClock ticks of the last sleep
+    [[nodiscard]] static lp_type lastSleep() noexcept { return _lastSleep; }
+
+    // SysTick ticks applied since startup
+    [[nodiscard]] static u64 total() noexcept { return _total; }
+
+private:
+    template<class P, class = void>
+    struct mask_of {
+        static constexpr lp_type value = std::numeric_limits<lp_type>::max();
+    };
+    template<class P>
+    struct mask_of<P, std::void_t<decltype(P::mask)>> {
+        static constexpr lp_type value = static_cast<lp_type>(P::mask);
+    };
+    static constexpr lp_type mask() noexcept { return mask_of<LpClock>::value; }
+
+    static void advanceTick(const value_type n) {
+#ifndef TIME_HOST_BUILD
+        TimeLock guard;
+        uwTick = uwTick + n;
+#else
+        HostTick::advance(n);
+#endif
+    }
+
+private:
+    static inline lp_type _t0        = 0;
+    static inline lp_type _lastSleep = 0;
+    static inline u64     _frac      = 0;   ///< lp * TickHz remainder, < ticksPerSecond()
+    static inline u64     _total     = 0;
+};
+
+//------------------------------------------------------------------------------
+// Low-power clock policies
+//------------------------------------------------------------------------------
+#ifndef TIME_HOST_BUILD
+
+#ifdef HAL_LPTIM_MODULE_ENABLED
+
+/**
+ * @brief LPTIM counter as a clock that runs in STOP.
+ *
+ * Configure the LPTIM on LSE/LSI, start it free-running with ARR = 0xFFFF
+ * (HAL_LPTIM_Counter_Start) and attach it with its counting rate.
+ */
+class LptimClock
+{
+    STATIC_CLASS(LptimClock);
+public:
+    using type_t = u32;
+    static constexpr type_t mask = 0xFFFFu;
+
+    // hz: counter rate after the prescaler (32768 / 128 = 256 Hz, ...)
+    static inline bool attach(LPTIM_HandleTypeDef* const hlptim, const u32 hz) noexcept {
+        _hlptim = hlptim;
+        _hz     = hz;
+        return isAvailable();
+    }
+
+    // CNT is clocked asynchronously: read until two reads agree (RM requirement)
+    static inline type_t now() noexcept {
+        if (_hlptim == nullptr) {
+            return 0;
+        }
+        type_t a = 0;
+        type_t b = _hlptim->Instance->CNT;
+        do {
+            a = b;
+            b = _hlptim->Instance->CNT;
+        } while (a != b);
+        return a;
+    }
+
+    static inline u32 ticksPerSecond() noexcept { return _hz; }
+    static inline bool isAvailable() noexcept { return _hlptim != nullptr && _hz != 0u; }
+
+private:
+    static inline LPTIM_HandleTypeDef* _hlptim = nullptr;
+    static inline u32                  _hz     = 0;
+};
+
+#endif /* HAL_LPTIM_MODULE_ENABLED */
+
+#else /* TIME_HOST_BUILD */
+
+/**
+ * @brief Simulated low-power clock: sleep(n) stands for n ticks spent in STOP.
+ */
+template<u32 Hz = 32768u>
+class SimLowPowerClock
+{
+    STATIC_CLASS(SimLowPowerClock);
+public:
+    using type_t = u32;
+
+    static inline type_t now() noexcept { return _now.load(std::memory_order_relaxed); }
+    static constexpr u32 ticksPerSecond() noexcept { return Hz; }
+    static constexpr bool isAvailable() noexcept { return true; }
+
+    static inline void sleep(const type_t n) noexcept { _now.fetch_add(n, std::memory_order_relaxed); }
+
+private:
+    static inline std::atomic<type_t> _now{0};
+};
+
+#endif /* TIME_HOST_BUILD */
+
+#endif /* STM32_TOOLS_TIME_LOWPOWER_H_ */
@@ -0,0 +1,214 @@
+/*
+ * PrecisionWait.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Hybrid wait: sleep on a coarse tick, finish with a spin on a fine clock
+ */
+
+#ifndef STM32_TOOLS_TIME_PRECISIONWAIT_H_
+#define STM32_TOOLS_TIME_PRECISIONWAIT_H_
+
+#include "interval_depency.h"
+#include <array>
+#include <limits>
+#include <type_traits>
+
+//------------------------------------------------------------------------------
+// PrecisionWait<Coarse, Fine, Sleep>
+//  - the deadline is kept on the Fine clock only (Dwt cycles, ns), the Coarse
+//    clock (Tick) is used to know when a tick edge has passed, never converted
+//  - coarse phase: Sleep::sleep() until Coarse::now() changes (WFI wakes on
+//    the SysTick edge), repeated while one more tick plus the margin still fits
+//    before the deadline
+//  - fine phase: spin on Fine::now() for the last [margin, tick + margin)
+//  - margin: wake-up jitter, measured as (wake - previous wake - tick) between
+//    consecutive sleeps; jumps up on a late wake (+25%), decays by 1/16 per
+//    on-time wake towards minMargin. An overshot coarse phase grows it too.
+//  - every wait records its error (fine ticks past the deadline) into stats()
+//
+// finePerCoarse is the tick length in Fine units (Tick/Dwt at 1 kHz:
+// DwtBuilder::from_milli(1)). Waits shorter than it only spin.
+//
+//     TickDwtWait w(DwtBuilder::from_milli(1));
+//     w.wait(DwtBuilder::from_micro(7500));    // ~7 ms asleep, then spin
+//------------------------------------------------------------------------------
+
+// Error distribution of PrecisionWait (fine ticks past the deadline)
+template<typename T>
+struct PrecisionWaitStats {
+    static constexpr u8 buckets = 32;
+
+    u32 count   = 0;
+    u32 overrun = 0;     ///< coarse phase woke past the deadline (margin too small)
+    T   max     = 0;
+    u64 sum     = 0;
+    u64 slept   = 0;     ///< fine ticks spent in the coarse phase
+    u64 spun    = 0;     ///< fine ticks spent spinning
+    std::array<u32, buckets> log2{};   ///< [0]: error 0, [k]: error in [2^(k-1), 2^k)
+
+    [[nodiscard]] T mean() const noexcept { return count ? static_cast<T>(sum / count) : T{0}; }
+
+    // Smallest error bound holding for `permille` of the waits (bucket upper edge)
+    [[nodiscard]] u64 percentile(const u32 permille) const noexcept {
+        const u64 need = (static_cast<u64>(count) * permille + 999u) / 1000u;
+        u64 seen = 0;
+        for (u8 k = 0; k < buckets; ++k) {
+            seen += log2[k];
+            if (seen >= need) {
+                return (k == 0u) ? 0u : (u64{1} << k) - 1u;
+            }
+        }
+        return max;
+    }
+};
+
+template<class Coarse, class Fine, class Sleep>
+class PrecisionWait
+{
+public:
+    using fine_t   = typename Fine::type_t;
+    using coarse_t = typename Coarse::type_t;
+    using Stats    = PrecisionWaitStats<fine_t>;
+
+    static_assert(std::is_unsigned_v<fine_t> && std::is_unsigned_v<coarse_t>,
+                  "PrecisionWait: clock types must be unsigned");
+
+    /**
+     * @param finePerCoarse one Coarse tick in Fine units.
+     * @param minMargin     margin floor in Fine units (spin at least this long).
+     */
+    explicit PrecisionWait(const fine_t finePerCoarse, const fine_t minMargin = 0) noexcept
+        : _tick(finePerCoarse ? finePerCoarse : fine_t{1}), _minMargin(minMargin), _margin(minMargin) {}
+
+    _DELETE_COPY_MOVE(PrecisionWait);
+
+    // Wait `duration` Fine ticks from now, returns the error (ticks past the deadline)
+    fine_t wait(const fine_t duration) {
+        return until(static_cast<fine_t>(Fine::now() + duration));
+    }
+
+    // Wait until the Fine clock reaches `deadline` (within half its range)
+    fine_t until(const fine_t deadline) {
+        const fine_t start = Fine::now();
+        fine_t f    = start;
+        fine_t prev = start;
+        bool   aligned = false;
+
+        // coarse phase: one more tick only if it surely ends before deadline - margin
+        while (isBefore(f, deadline) && static_cast<fine_t>(deadline - f) > _tick + _margin) {
+            const coarse_t c = Coarse::now();
+            do {
+                Sleep::sleep();
+            } while (Coarse::now() == c);
+
+            f = Fine::now();
+            if (aligned) {
+                const fine_t period = static_cast<fine_t>(f - prev);
+                tune((period > _tick) ? static_cast<fine_t>(period - _tick) : fine_t{0});
+            }
+            aligned = true;
+            prev    = f;
+        }
+
+        const fine_t handoff = f;
+        if (!isBefore(handoff, deadline)) {
+            ++_stats.overrun;
+            tune(static_cast<fine_t>(_margin + (handoff - deadline) + 1u));
+        }
+
+        // fine phase
+        while (isBefore(f, deadline)) {
+            f = Fine::now();
+        }
+
+        const fine_t error = static_cast<fine_t>(f - deadline);
+        record(error, static_cast<fine_t>(handoff - start), static_cast<fine_t>(f - handoff));
+        return error;
+    }
+
+    [[nodiscard]] constexpr fine_t margin() const noexcept { return _margin; }
+    [[nodiscard]] constexpr fine_t tick()   const noexcept { return _tick; }
+
+    // Coarse tick length changed (e.g. new SystemCoreClock for Dwt)
+    void setTick(const fine_t finePerCoarse) noexcept { _tick = finePerCoarse ? finePerCoarse : fine_t{1}; }
+
+    [[nodiscard]] constexpr const Stats& stats() const noexcept { return _stats; }
+    void resetStats() noexcept { _stats = Stats{}; }
+
+private:
+    static constexpr fine_t half = static_cast<fine_t>(std::numeric_limits<fine_t>::max() / 2u + 1u);
+
+    // a strictly before b, modulo the type range
+    static constexpr bool isBefore(const fine_t a, const fine_t b) noexcept {
+        return static_cast<fine_t>(a - b) >= half;
+    }
+
+    void tune(const fine_t late) noexcept {
+        if (late > _margin) {
+            _margin = static_cast<fine_t>(late + (late >> 2));
+        } else {
+            _margin = static_cast<fine_t>(_margin - ((_margin - _minMargin) >> 4));
+        }
+    }
+
+    void record(const fine_t error, const fine_t slept, const fine_t spun) noexcept {
+        u8 k = 0;
+        for (fine_t e = error; e != 0u && k < Stats::buckets - 1u; e >>= 1) {
+            ++k;
+        }
+        ++_stats.log2[k];
+        ++_stats.count;
+        _stats.sum   += error;
+        _stats.max    = (error > _stats.max) ? error : _stats.max;
+        _stats.slept += slept;
+        _stats.spun  += spun;
+    }
+
+private:
+    fine_t       _tick;        ///< one Coarse tick in Fine units
+    const fine_t _minMargin;
+    fine_t       _margin;      ///< handoff margin, auto-tuned
+    Stats        _stats{};
+};
+
+//------------------------------------------------------------------------------
+// Sleep policies: static void sleep(), returns after some event (any interrupt)
+//------------------------------------------------------------------------------
+#ifndef TIME_HOST_BUILD
+
+// Core sleeps until the next interrupt (SysTick at the latest)
+struct WfiSleep {
+    static inline void sleep() noexcept { __WFI(); }
+};
+
+#include "Tick.h"
+#include "Dwt.h"
+#ifdef DWT_TIME_IS_EXISTS
+using TickDwtWait = PrecisionWait<Tick, Dwt, WfiSleep>;
+#endif /* DWT_TIME_IS_EXISTS */
+
+#else /* TIME_HOST_BUILD */
+
+#include <thread>
+
+struct YieldSleep {
+    static inline void sleep() { std::this_thread::yield(); }
+};
+
+template<u32 Us>
+struct NapSleep {
+    static inline void sleep() { std::this_thread::sleep_for(std::chrono::microseconds(Us)); }
+};
+
+#include "HostTick.h"
+#include "LinuxClock.h"
+#ifdef LINUX_TIME_IS_EXISTS
+template<class Sleep = NapSleep<100>>
+using HostPrecisionWait = PrecisionWait<HostTick, Monotonic, Sleep>;
+#endif /* LINUX_TIME_IS_EXISTS */
+
+#endif /* TIME_HOST_BUILD */
+
+#endif /* STM32_TOOLS_TIME_PRECISIONWAIT_H_ */
@@ -0,0 +1,217 @@
+/*
+ * RateMeter.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Sliding-window event rate: lock-free O(1) add() from any context, O(1) sum
+ */
+
+#ifndef STM32_TOOLS_TIME_RATEMETER_H_
+#define STM32_TOOLS_TIME_RATEMETER_H_
+
+#include "interval_depency.h"
+#include <array>
+#include <atomic>
+#include <limits>
+#include <type_traits>
+
+//------------------------------------------------------------------------------
+// RateMeter<Policy, Buckets>
+//  - time is cut into buckets of 2^k ticks (bucketTicks rounded up), the
+//    window is the last Buckets of them, the current one partially
+//  - every bucket is one atomic word: 8-bit epoch tag + 24-bit count.
+//    add() is one CAS on it; a bucket left over from an older epoch is
+//    replaced by the same CAS, so no context ever clears buckets ahead of time
+//  - the running sum is kept next to the buckets: add() adds, replacing an
+//    old bucket subtracts it. Each epoch change (lazily, from whoever sees
+//    the new epoch first) retires the buckets that left the window, at most
+//    Buckets per call, amortized O(1) per bucket of time
+//  - sum()/rate(): O(1), a plain load after the epoch check
+//  - ewma(): exponentially weighted bucket count (alpha = 2^-ewmaShift),
+//    folded from completed buckets by the reading context (one reader);
+//    call it at least once per window, older buckets read as empty
+//
+// add() may be called from any ISR/thread (lock-free on Cortex-M3+ and hosts:
+// LDREX/STREX or a native CAS; Cortex-M0 goes through libatomic). Buckets
+// saturate at 2^24 - 1 events. An add() preempted for longer than the window
+// lands in the newest bucket of its slot or is retired with it.
+//
+//     RateMeter<Tick, 16> rxRate(64);                // 16 x 64 ms = ~1 s window
+//     void USART1_IRQHandler() { rxRate.add(); }
+//     u32 perSecond = rxRate.rate(1000);             // messages per second
+//------------------------------------------------------------------------------
+template<class Policy, u16 Buckets = 16>
+class RateMeter
+{
+public:
+    using value_type = typename Policy::type_t;
+
+    static_assert(std::is_unsigned_v<value_type>, "RateMeter: Policy::type_t must be unsigned");
+    static_assert(Buckets >= 2u && Buckets <= 128u && (Buckets & (Buckets - 1u)) == 0u,
+                  "RateMeter: Buckets must be a power of two in [2, 128] (8-bit epoch tags)");
+
+    /**
+     * @param bucketTicks bucket length in Policy ticks, rounded up to a power of two.
+     * @param ewmaShift   EWMA weight of a new bucket: 2^-ewmaShift.
+     */
+    explicit RateMeter(const value_type bucketTicks = 1, const u8 ewmaShift = 3) noexcept
+        : _shift(shiftOf(bucketTicks)), _ewmaShift(ewmaShift < 16u ? ewmaShift : u8{15})
+    {
+        const u32 e = epochOf(Policy::now());
+        _head.store(e, std::memory_order_relaxed);
+        _ewmaEpoch = e;
+        for (u16 i = 0; i < Buckets; ++i) {
+            // tag each slot with the epoch it holds in the current window
+            _slot[i].store(pack(static_cast<u32>(e - ((e - i) & (Buckets - 1u))), 0u), std::memory_order_relaxed);
+        }
+    }
+
+    _DELETE_COPY_MOVE(RateMeter);
+
+    // Count n events now. Lock-free, any context.
+    void add(const u32 n = 1) noexcept {
+        const u32 e = epochOf(Policy::now());
+        advance(e);
+
+        std::atomic<u32>& slot = _slot[e & (Buckets - 1u)];
+        u32 w = slot.load(std::memory_order_relaxed);
+        for (;;) {
+            const bool stale = isOlder(tagOf(w), e);    // older epoch: reuse for e
+            const u32  c     = stale ? 0u : countOf(w);
+            const u32  added = (n < count_max - c) ? n : (count_max - c);
+            const u32  nw    = stale ? pack(e, added) : static_cast<u32>(w + added);
+
+            if (slot.compare_exchange_weak(w, nw, std::memory_order_relaxed)) {
+                _sum.fetch_add(static_cast<i32>(added) - (stale ? static_cast<i32>(countOf(w)) : 0),
+                               std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    // Events in the window (last Buckets - 1 buckets + the current part)
+    [[nodiscard]] u32 sum() noexcept {
+        advance(epochOf(Policy::now()));
+        const i32 s = _sum.load(std::memory_order_relaxed);
+        return (s > 0) ? static_cast<u32>(s) : 0u;   // transiently < 0 while an add() is half done
+    }
+
+    // Events per `per` ticks over the window (rate(1000) on Tick: per second)
+    [[nodiscard]] u32 rate(const u64 per) noexcept {
+        const value_type now  = Policy::now();
+        advance(epochOf(now));
+        const i32 s = _sum.load(std::memory_order_relaxed);
+        const u64 span = (static_cast<u64>(Buckets - 1u) << _shift)
+                       + (static_cast<u64>(now) & ((u64{1} << _shift) - 1u)) + 1u;
+        return (s > 0) ? static_cast<u32>(static_cast<u64>(s) * per / span) : 0u;
+    }
+
+    /**
+     * @brief EWMA of completed bucket counts, events per bucket in Q8.
+     *
+     * Single reader context: the fold state is not shared.
+     */
+    [[nodiscard]] u32 ewma() noexcept {
+        const u32 e = epochOf(Policy::now());
+        advance(e);
+
+        const u32 pending = (e - _ewmaEpoch) & _emask;   // completed buckets not folded yet
+        if (pending > _emask / 2u) {
+            return static_cast<u32>(_ewma);               // e older than the last fold: nothing new
+        }
+        // buckets beyond the window are empty; past ~16 weights the value is 0 anyway
+        const u32 limit = static_cast<u32>(Buckets - 1u) + (16u << _ewmaShift);
+        u32 x = (e - ((pending < limit) ? pending : limit)) & _emask;
+        for (; x != e; x = (x + 1u) & _emask) {
+            const u32 w = _slot[x & (Buckets - 1u)].load(std::memory_order_relaxed);
+            const i64 c = (tagOf(w) == (x & 0xFFu)) ? (static_cast<i64>(countOf(w)) << 8) : 0;
+            _ewma += (c - _ewma) / (i64{1} << _ewmaShift);
+        }
+        _ewmaEpoch = e;
+        return static_cast<u32>(_ewma);
+    }
+
+    // ewma() as events per `per` ticks
+    [[nodiscard]] u32 ewmaRate(const u64 per) noexcept {
+        return static_cast<u32>((static_cast<u64>(ewma()) * per) >> (_shift + 8u));
+    }
+
+    [[nodiscard]] value_type bucketTicks() const noexcept { return static_cast<value_type>(value_type{1} << _shift); }
+    [[nodiscard]] u64 windowTicks() const noexcept { return static_cast<u64>(Buckets) << _shift; }
+    [[nodiscard]] static constexpr u16 buckets() noexcept { return Buckets; }
+
+private:
+    static constexpr u32 count_bits = 24;
+    static constexpr u32 count_max  = (1u << count_bits) - 1u;
+
+    static constexpr u32 pack(const u32 epoch, const u32 c) noexcept { return (epoch << count_bits) | c; }
+    static constexpr u32 tagOf(const u32 w) noexcept { return w >> count_bits; }
+    static constexpr u32 countOf(const u32 w) noexcept { return w & count_max; }
+
+    // 8-bit tag of an epoch before e (within 127 epochs)
+    static constexpr bool isOlder(const u32 tag, const u32 e) noexcept {
+        const u8 d = static_cast<u8>(e - tag);
+        return d != 0u && d < 128u;
+    }
+
+    static u8 shiftOf(const value_type ticks) noexcept {
+        u8 s = 0;
+        while (s < std::numeric_limits<value_type>::digits - 8 && (value_type{1} << s) < ticks) {
+            ++s;
+        }
+        return s;
+    }
+
+    // epoch numbers wrap with the clock: mask = (type range >> shift), at most 32 bits
+    u32 epochOf(const value_type now) const noexcept { return static_cast<u32>(now >> _shift) & _emask; }
+
+    // First context to see epoch e retires the buckets leaving the window
+    void advance(const u32 e) noexcept {
+        u32 head = _head.load(std::memory_order_relaxed);
+        u32 gap  = 0;
+        do {
+            gap = (e - head) & _emask;
+            if (gap == 0u || gap > _emask / 2u) {
+                return;                                   // same epoch, or e is stale
+            }
+        } while (!_head.compare_exchange_weak(head, e, std::memory_order_relaxed));
+
+        // this context owns epochs (head, e]: give their slots the new tags.
+        // A slot already tagged x was just claimed by a concurrent add(): keep it.
+        // After >= 128 idle epochs isOlder() no longer holds, so every other
+        // tag is retired; tag x itself only if the slot's previous epoch
+        // (the last one <= head on it) aliases x in 8 bits.
+        const bool idle  = gap >= 128u;
+        const u32  steps = (gap < Buckets) ? gap : Buckets;
+        for (u32 i = 0; i < steps; ++i) {
+            const u32  x     = (e - i) & _emask;
+            const u32  y     = head - ((head - x) & (Buckets - 1u));
+            const bool alias = idle && ((x - y) & 0xFFu) == 0u;
+            std::atomic<u32>& slot = _slot[x & (Buckets - 1u)];
+            u32 w = slot.load(std::memory_order_relaxed);
+            while ((tagOf(w) != (x & 0xFFu)) ? (idle || isOlder(tagOf(w), x)) : alias) {
+                if (slot.compare_exchange_weak(w, pack(x, 0u), std::memory_order_relaxed)) {
+                    _sum.fetch_sub(static_cast<i32>(countOf(w)), std::memory_order_relaxed);
+                    break;
+                }
+            }
+        }
+    }
+
+private:
+    const u8 _shift;
+    const u8 _ewmaShift;
+    const u32 _emask = static_cast<u32>(
+        (static_cast<u64>(std::numeric_limits<value_type>::max()) >> _shift) & 0xFFFFFFFFull);
+
+    std::array<std::atomic<u32>, Buckets> _slot{};
+    std::atomic<u32> _head{0};   ///< newest epoch seen
+    std::atomic<i32> _sum{0};    ///< sum of all bucket counts
+
+    // reader-side EWMA state
+    u32 _ewmaEpoch = 0;
+    i64 _ewma      = 0;          ///< Q8
+};
+
+#endif /* STM32_TOOLS_TIME_RATEMETER_H_ */
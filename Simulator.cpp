@@ -0,0 +1,114 @@
+/*
+ * Simulator.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ */
+
+#include "Simulator.h"
+
+#ifdef TIME_SIM_BUILD
+
+#include <limits>
+
+SimBoard::SimBoard(const SimConfig& cfg, const u32 id)
+    : _cfg(cfg), _id(id),
+      _tickPeriod((cfg.tickHz != 0u && cfg.hz >= cfg.tickHz) ? (cfg.hz / cfg.tickHz) : 1u),
+      _nextTick(_tickPeriod)
+{
+    // the thread's clocks now belong to this board; domain tick counts and
+    // prescaler phases restart lazily (time_board_epoch, lock_policy.h)
+    ++time_board_epoch;
+    SimClock::_now   = 0;
+    SimClock::_hz    = cfg.hz;
+    SimTick::_ticks  = 0;
+    SimTick::_hz     = cfg.tickHz;
+    _current = this;
+    _events.reserve(64);
+}
+
+SimBoard::~SimBoard()
+{
+    if (_current == this) {
+        _current = nullptr;
+    }
+}
+
+void SimBoard::at(const u64 instant, const Event fn, void* const user)
+{
+    if (fn == nullptr) {
+        return;
+    }
+    _events.push_back(Entry{instant, _seq++, fn, user});
+    std::push_heap(_events.begin(), _events.end(), later);
+}
+
+u64 SimBoard::nextInstant(const u64 end)
+{
+    const u64 now = _now();
+    u64 t = end;
+
+    if (!_events.empty()) {
+        t = std::min(t, std::max(_events.front().instant, now));
+    }
+    if (_wake != never) {
+        t = std::min(t, std::max(_wake, now + 1u));   // a loop-only step always moves the clock
+    }
+
+    // first SysTick at which a virtual timer runs out
+    const VTimer::value_type v = VTimer::nextExpiry();
+    const AutoVTimer::value_type a = AutoVTimer::nextExpiry();
+    const u64 k = (v == 0u) ? a : ((a == 0u) ? v : std::min<u64>(v, a));
+    if (k != 0u) {
+        t = std::min(t, _nextTick + (k - 1u) * _tickPeriod);
+    }
+
+    if (_cfg.maxSkip != 0u) {
+        t = std::min(t, now + _cfg.maxSkip);
+    }
+    return t;
+}
+
+void SimBoard::advanceTo(const u64 t)
+{
+    const u64 now = _now();
+    if (t <= now) {
+        return;
+    }
+    SimClock::_now = t;
+    _stats.simTicks += t - now;
+
+    if (t >= _nextTick) {
+        // SysTick ISRs in (now, t]: one bulk pass, as n HAL_SYSTICK_Callback() calls
+        u64 n = (t - _nextTick) / _tickPeriod + 1u;
+        _nextTick       += n * _tickPeriod;
+        SimTick::_ticks += n;
+        _stats.sysTicks += n;
+
+        constexpr u64 chunk = std::numeric_limits<VTimer::value_type>::max();
+        while (n != 0u) {
+            const auto step = static_cast<VTimer::value_type>(std::min(n, chunk));
+            VTimer::advance(step);
+            AutoVTimer::advance(step);
+            n -= step;
+        }
+    }
+
+    if (_wake <= t) {
+        _wake = never;
+    }
+}
+
+void SimBoard::fire(const u64 t)
+{
+    while (!_events.empty() && _events.front().instant <= t) {
+        std::pop_heap(_events.begin(), _events.end(), later);
+        const Entry e = _events.back();
+        _events.pop_back();
+
+        ++_stats.events;
+        e.fn(*this, e.user);
+    }
+}
+
+#endif /* TIME_SIM_BUILD */
@@ -0,0 +1,324 @@
+/*
+ * Simulator.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Discrete-event simulation of many boards on the host, one board per thread at a time
+ */
+
+#ifndef STM32_TOOLS_TIME_SIMULATOR_H_
+#define STM32_TOOLS_TIME_SIMULATOR_H_
+
+#include "interval_depency.h"
+
+#if defined(TIME_SIM_BUILD)
+
+#include "lock_policy.h"
+#include "interval/Deadline.h"
+#include "virtual/VTimer.h"
+#include "virtual/AutoVTimer.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+//------------------------------------------------------------------------------
+// Simulated time, -DTIME_SIM_BUILD (host only)
+//
+//  - every SimBoard owns its timeline: SimClock (fine clock, e.g. 1 MHz) and
+//    SimTick (SysTick count) read the board of the calling thread; VTimer and
+//    AutoVTimer registries are thread_local (TIME_BOARD_LOCAL), so firmware
+//    objects built on that thread belong to that board only
+//  - the clock never waits: after each main-loop pass it jumps to the earliest
+//    of: a scheduled event (ISR stimulus), the next VTimer/AutoVTimer expiry,
+//    the loop's own wake hint (wakeAt()/wakeIn()), the end of the run
+//  - SysTick ISRs in between are applied in one bulk pass per registry
+//    (advance(n)), which equals n HAL_SYSTICK_Callback() calls
+//  - same instant: SysTick first, then events in scheduling order, then loop()
+//  - Simulator runs N boards over T threads; a board runs to completion on
+//    the thread that took it, so results do not depend on the thread count
+//
+// Polled deadlines (ITimeBase, OneShotIBase, Deadline) are invisible to the
+// engine: announce them with wakeAt(timer.deadline()), or bound every jump
+// with SimConfig::maxSkip (a fixed main-loop cadence). Other tick domains are
+// driven by events calling BasicVTimer<Domain>::tick().
+//------------------------------------------------------------------------------
+
+#ifndef TIME_TICK_HZ
+#define TIME_TICK_HZ 1000u
+#endif
+
+struct SimConfig {
+    u32 hz      = 1'000'000u;    ///< SimClock rate
+    u32 tickHz  = TIME_TICK_HZ;  ///< SysTick rate, must divide hz
+    u64 maxSkip = 0;             ///< longest jump in SimClock ticks, 0 = unbounded
+};
+
+// Work done by one board or summed over a run
+struct SimStats {
+    u64 simTicks = 0;   ///< SimClock ticks simulated
+    u64 sysTicks = 0;   ///< SysTick ISRs applied
+    u64 events   = 0;   ///< event callbacks run
+    u64 loops    = 0;   ///< main-loop passes (= clock jumps + 1)
+
+    SimStats& operator+=(const SimStats& o) noexcept {
+        simTicks += o.simTicks;
+        sysTicks += o.sysTicks;
+        events   += o.events;
+        loops    += o.loops;
+        return *this;
+    }
+};
+
+class SimBoard;
+
+//------------------------------------------------------------------------------
+// SimClock: SimConfig::hz ticks of the calling thread's board
+//------------------------------------------------------------------------------
+class SimClock
+{
+    STATIC_CLASS(SimClock);
+    friend class SimBoard;
+public:
+    using type_t = u32;
+
+    static inline type_t now() noexcept { return static_cast<type_t>(_now); }
+    static inline u64 now64() noexcept { return _now; }
+    static constexpr inline bool isAvailable() noexcept { return true; }
+    static inline u32 ticksPerSecond() noexcept { return _hz; }
+
+private:
+    static inline thread_local u64 _now = 0;
+    static inline thread_local u32 _hz  = 1'000'000u;
+};
+
+//------------------------------------------------------------------------------
+// SimTick: SysTick count of the calling thread's board (uwTick / Tick)
+//------------------------------------------------------------------------------
+class SimTick
+{
+    STATIC_CLASS(SimTick);
+    friend class SimBoard;
+public:
+    using type_t = u32;
+    using tick_domain = SysTickDomain;   ///< now() counts the ticks VTimers count down
+
+    static inline type_t now() noexcept { return static_cast<type_t>(_ticks); }
+    static constexpr inline bool isAvailable() noexcept { return true; }
+    static inline u32 ticksPerSecond() noexcept { return _hz; }
+
+private:
+    static inline thread_local u64 _ticks = 0;
+    static inline thread_local u32 _hz    = TIME_TICK_HZ;
+};
+
+//------------------------------------------------------------------------------
+// SimBoard: one timeline. Constructed on the thread that simulates it,
+// at most one per thread at a time.
+//------------------------------------------------------------------------------
+class SimBoard
+{
+public:
+    // Event (ISR stimulus): runs at its instant, may schedule further events
+    using Event = void (*)(SimBoard&, void* user);
+
+    explicit SimBoard(const SimConfig& cfg = {}, const u32 id = 0);
+    ~SimBoard();
+
+    _DELETE_COPY_MOVE(SimBoard);
+
+    // Board of the calling thread (nullptr outside a simulation)
+    [[nodiscard]] static SimBoard* current() noexcept { return _current; }
+
+    // Schedule fn at an absolute SimClock instant (past instants run at once)
+    void at(const u64 instant, const Event fn, void* const user = nullptr);
+
+    // Schedule fn `delay` SimClock ticks from now
+    void after(const u64 delay, const Event fn, void* const user = nullptr) { at(_now() + delay, fn, user); }
+
+    // Main-loop wake hint: run loop() again no later than this instant
+    void wakeAt(const u64 instant) noexcept { _wake = std::min(_wake, instant); }
+    void wakeIn(const u64 delay) noexcept { wakeAt(_now() + delay); }
+
+    // Wake hint from a polled deadline (ITimeBase::deadline(), OneShotIBase::deadline())
+    void wakeAt(const Deadline<SimClock> dl) noexcept { wakeIn(dl.remaining(SimClock::now())); }
+
+    // Ends run() after the current step
+    void stop() noexcept { _stopped = true; }
+
+    /**
+     * @brief Simulates `duration` SimClock ticks, calling loop() after every step.
+     * @return SimClock instant reached (the end, or earlier after stop()).
+     */
+    template<class Loop>
+    u64 run(const u64 duration, Loop&& loop) {
+        const u64 end = _now() + duration;
+        _stopped = false;
+        while (!_stopped) {
+            loop();
+            ++_stats.loops;
+
+            const u64 t = nextInstant(end);
+            if (t >= end) {
+                advanceTo(end);
+                break;
+            }
+            advanceTo(t);
+            fire(t);
+        }
+        return _now();
+    }
+
+    [[nodiscard]] u64 now() const noexcept { return _now(); }
+    [[nodiscard]] u32 id() const noexcept { return _id; }
+    [[nodiscard]] const SimConfig& config() const noexcept { return _cfg; }
+    [[nodiscard]] const SimStats& stats() const noexcept { return _stats; }
+
+private:
+    struct Entry {
+        u64   instant;
+        u64   seq;      ///< FIFO among equal instants
+        Event fn;
+        void* user;
+    };
+
+    static constexpr u64 never = ~u64{0};
+
+    static bool later(const Entry& a, const Entry& b) noexcept {
+        return (a.instant != b.instant) ? (a.instant > b.instant) : (a.seq > b.seq);
+    }
+
+    static u64 _now() noexcept { return SimClock::_now; }
+
+    // Earliest of: event, timer expiry, wake hint, maxSkip, end
+    u64 nextInstant(const u64 end);
+
+    // Moves the clock to t, applying the SysTicks in (now, t]
+    void advanceTo(const u64 t);
+
+    // Runs every event due at or before t
+    void fire(const u64 t);
+
+private:
+    const SimConfig    _cfg;
+    const u32          _id;
+    const u64          _tickPeriod;       ///< SimClock ticks per SysTick
+    u64                _nextTick;         ///< instant of the next SysTick
+    u64                _wake    = never;
+    u64                _seq     = 0;
+    bool               _stopped = false;
+    std::vector<Entry> _events;           ///< min-heap by (instant, seq)
+    SimStats           _stats{};
+
+    static inline thread_local SimBoard* _current = nullptr;
+};
+
+//------------------------------------------------------------------------------
+// Simulator: N independent boards spread over host threads
+//------------------------------------------------------------------------------
+struct SimReport {
+    SimStats stats{};
+    u32      boards  = 0;
+    u32      threads = 0;
+    u64      wallNs  = 0;
+    u32      hz      = 0;
+
+    // Simulated board-seconds per wall-clock second, all boards together
+    [[nodiscard]] double simSecondsPerWallSecond() const noexcept {
+        return (wallNs && hz) ? (static_cast<double>(stats.simTicks) / hz) / (static_cast<double>(wallNs) * 1e-9) : 0.0;
+    }
+};
+
+class Simulator
+{
+public:
+    /**
+     * @param cfg      per-board clock configuration
+     * @param threads  worker count (0 = hardware concurrency)
+     */
+    explicit Simulator(const SimConfig& cfg = {}, unsigned threads = 0) : _cfg(cfg) {
+        if (threads == 0u) {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        _threads = threads;
+    }
+
+    _DELETE_COPY_MOVE(Simulator);
+
+    /**
+     * @brief Simulates `boards` boards for `duration` SimClock ticks each.
+     *
+     * Firmware: constructed on the worker thread as Firmware(SimBoard&), then
+     * loop(SimBoard&) is its main-loop pass; destroyed when the board ends
+     * (store per-board results by board.id() there).
+     */
+    template<class Firmware>
+    SimReport run(const u32 boards, const u64 duration) {
+        std::atomic<u32> next{0};
+        std::vector<SimStats> partial(_threads);
+
+        auto worker = [&](const unsigned w) {
+            for (u32 i = next.fetch_add(1u, std::memory_order_relaxed); i < boards;
+                 i = next.fetch_add(1u, std::memory_order_relaxed)) {
+                SimBoard board(_cfg, i);
+                {
+                    Firmware fw(board);
+                    board.run(duration, [&] { fw.loop(board); });
+                }
+                partial[w] += board.stats();
+            }
+        };
+
+        const auto t0 = std::chrono::steady_clock::now();
+        std::vector<std::thread> pool;
+        pool.reserve(_threads - 1u);
+        for (unsigned w = 1; w < _threads; ++w) {
+            pool.emplace_back(worker, w);
+        }
+        worker(0);   // the calling thread is worker 0
+        for (auto& t : pool) {
+            t.join();
+        }
+        const auto t1 = std::chrono::steady_clock::now();
+
+        SimReport r;
+        for (const auto& s : partial) {
+            r.stats += s;
+        }
+        r.boards  = boards;
+        r.threads = _threads;
+        r.hz      = _cfg.hz;
+        r.wallNs  = static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        return r;
+    }
+
+    [[nodiscard]] unsigned threads() const noexcept { return _threads; }
+
+private:
+    const SimConfig _cfg;
+    unsigned        _threads = 1;
+};
+
+// interval ----------------------------
+#include "interval/ITimeBase.h"
+template<auto Interval = 0u>
+using SimITimer = ITimeBase<Interval, SimClock>;
+
+#include "interval/OneShotIBase.h"
+template<auto Interval = 0u>
+using OneShotISim = OneShotIBase<Interval, SimClock>;
+
+// virtual ---------------------------------
+#include "virtual/VTimeBase.h"
+template<auto Interval = 0u>
+using SimVTimer = VTimeBase<Interval, SimTick>;
+
+#include "virtual/OneShotVBase.h"
+template<auto Interval = 0u>
+using OneShotVSim = OneShotVBase<Interval, SimTick>;
+
+#endif /* TIME_SIM_BUILD */
+
+#endif /* STM32_TOOLS_TIME_SIMULATOR_H_ */
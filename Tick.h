@@ -16,6 +16,13 @@
 
 extern "C" __IO uint32_t uwTick;
 
+// SysTick rate (HAL default: 1 kHz, uwTickFreq = HAL_TICK_FREQ_1KHZ)
+#ifndef TIME_TICK_HZ
+#define TIME_TICK_HZ 1000u
+#endif
+
+struct SysTickDomain;
+
 // Mark class as static-only using macro (e.g., delete constructor, etc.)
 class Tick
 {
@@ -23,10 +30,12 @@ class Tick
 
 public:
     using type_t = u32;
+    using tick_domain = SysTickDomain;   ///< now() counts the ticks VTimers count down
 
     // Return current system tick count (from SysTick)
     static inline type_t now() noexcept { return uwTick; }
     static constexpr inline bool isAvailable() noexcept { return true; }
+    static constexpr inline u32 ticksPerSecond() noexcept { return TIME_TICK_HZ; }
 };
 
 // interval ----------------------------
@@ -38,6 +47,11 @@ using TickITimer = ITimeBase<Interval, Tick>;
 template<auto Interval = 0u>
 using OneShotITick = OneShotIBase<Interval, Tick>;
 
+#include "interval/PackedOneShotIBase.h"
+template<auto Interval = 0u, typename Storage = Tick::type_t,
+         PackedStore Store = PackedStore::LastTime>
+using PackedOneShotITick = PackedOneShotIBase<Interval, Tick, Storage, Store>;
+
 // virtual ---------------------------------
 #include "virtual/VTimeBase.h"
 template<auto Interval = 0u>
@@ -47,5 +61,11 @@ using TickVTimer = VTimeBase<Interval, Tick>;
 template<auto Interval = 0u>
 using OneShotVTick = OneShotVBase<Interval, Tick>;
 
+// Per-timer footprint (README, "Virtual timers"): counter + stamp [+ interval]
+static_assert(sizeof(TickVTimer<100u>) == sizeof(VTimer) + sizeof(Tick::type_t), "TickVTimer<100u>: counter + stamp");
+static_assert(sizeof(TickVTimer<>) == sizeof(VTimer) + 2 * sizeof(Tick::type_t), "TickVTimer<>: counter + interval + stamp");
+static_assert(sizeof(OneShotVTick<100u>) == sizeof(TickVTimer<100u>), "OneShotVTick<100u>: state bits live in the stamp");
+static_assert(sizeof(OneShotVTick<>) == sizeof(TickVTimer<>), "OneShotVTick<>: state bits live in the stamp");
+
 
 #endif /* STM32_TOOLS_TIME_TICK_H_ */
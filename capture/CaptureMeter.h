@@ -0,0 +1,233 @@
+/*
+ * CaptureMeter.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Frequency / period meter over input-capture timestamps written by circular DMA
+ */
+
+#ifndef STM32_TOOLS_TIME_CAPTURE_CAPTUREMETER_H_
+#define STM32_TOOLS_TIME_CAPTURE_CAPTUREMETER_H_
+
+#include "time/interval_depency.h"
+#include <array>
+#include <limits>
+#include <type_traits>
+
+//------------------------------------------------------------------------------
+// Source contract (all static, see HTimerCapture in HTimer.h):
+//   using sample_t                       - DMA element (u16 for 16-bit TIM, u32 for TIM2/TIM5)
+//   static constexpr sample_t mask       - counter modulus - 1 (ARR, 2^k - 1)
+//   static bool start(sample_t*, u16 n)  - start capture into a circular buffer of n samples
+//   static void stop()                   - stop capture and DMA
+//   static u16  remaining()              - DMA items left before the buffer wraps (NDTR)
+//   static bool isAvailable()            - timer attached and running
+//
+// HostCapture (capture/HostCapture.h) implements it on plain variables.
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// CaptureMeter<Source, N, Window>:
+//   - N-sample ring filled by DMA: no interrupt per edge, the CPU touches the
+//     samples only when a result is read
+//   - every read first consumes the new samples in one batch (O(new samples)),
+//     periods are timestamp differences modulo (mask + 1)
+//   - average over the last Window periods, kept as a running sum
+//   - overrun: when N or more edges arrive between two reads the DMA laps the
+//     ring and the period across the gap is unknown. update() sees the lap
+//     as an overwritten last-consumed sample, counts it in overruns(), drops
+//     the average and restarts from the N - 1 newest samples. A batch that
+//     the DMA may have caught up with while it was read is dropped the same way.
+//
+// Limits:
+//   - one period must be shorter than the counter range (mask + 1 ticks);
+//     slow signals need a prescaled timer
+//   - read at least once per N - 1 edges for a gapless average and edges()
+//     count; after an overrun edges() misses the overwritten ones
+//   - a lap goes unseen only if the overwriting capture has the same counter
+//     value as the sample it replaces (N periods summing to a multiple of
+//     mask + 1), or if it happens before the first edge is consumed
+//   - the meter owns the DMA buffer: stop() (or destroy) before it goes away
+//------------------------------------------------------------------------------
+template<class Source, u16 N = 32, u16 Window = 8>
+class CaptureMeter
+{
+public:
+    using sample_t = typename Source::sample_t;
+    using period_t = u32;
+
+    static_assert(std::is_unsigned_v<sample_t> && sizeof(sample_t) <= sizeof(u32),
+                  "CaptureMeter: Source::sample_t must be unsigned and at most 32-bit");
+    static_assert(((Source::mask + 1u) & Source::mask) == 0u, "CaptureMeter: Source::mask must be 2^k - 1");
+    static_assert(N >= 2, "CaptureMeter: ring needs at least two samples");
+    static_assert(Window >= 1 && Window < N, "CaptureMeter: Window must be in [1, N)");
+
+    constexpr CaptureMeter() noexcept = default;
+    ~CaptureMeter() { stop(); }
+
+    _DELETE_COPY_MOVE(CaptureMeter);
+
+    // Start capturing, previous results are discarded
+    bool start() {
+        reset();
+        _tail    = 0;       // DMA restarts at the beginning of the ring
+        _running = Source::start(const_cast<sample_t*>(_ring.data()), N);
+        return _running;
+    }
+
+    void stop() {
+        if (_running) {
+            Source::stop();
+            _running = false;
+        }
+    }
+
+    // Forget the measurement, keep capturing
+    void reset() noexcept {
+        _tail     = head();
+        _edges    = 0;
+        _overruns = 0;
+        restart();
+    }
+
+    /**
+     * @brief Consume the samples captured since the last call. Called by every getter.
+     * @return number of new samples.
+     */
+    u16 update() noexcept {
+        const u16 h = head();
+        u16 n = distance(_tail, h);
+
+        if (_primed && _ring[prev(_tail)] != _prev) {
+            // the DMA overwrote the last consumed sample: N or more edges since
+            // the last read. The ring holds the newest N samples from h on, and
+            // slot h is the next one written.
+            ++_overruns;
+            restart();
+            _tail = next(h);
+            n     = static_cast<u16>(N - 1u);
+        }
+
+        for (u16 i = 0; i < n; ++i) {
+            const sample_t s = _ring[_tail];
+            _tail = next(_tail);
+
+            if (!_primed) {     // first edge: nothing to measure against
+                _primed = true;
+                _prev   = s;
+                continue;
+            }
+            push(static_cast<period_t>(static_cast<sample_t>(s - _prev) & Source::mask));
+            _prev = s;
+        }
+        _edges += n;
+
+        // more than N - n edges during the batch: its oldest samples may have
+        // been overwritten before they were read
+        if (n != 0u && distance(h, head()) > N - n) {
+            ++_overruns;
+            restart();
+        }
+        return n;
+    }
+
+    // Last period in timer ticks (0 before two edges)
+    [[nodiscard]] period_t period() noexcept {
+        update();
+        return _last;
+    }
+
+    // Mean of the last Window periods in timer ticks, rounded (0 before two edges)
+    [[nodiscard]] period_t average() noexcept {
+        update();
+        return _filled ? static_cast<period_t>((_sum + _filled / 2u) / _filled) : period_t{0};
+    }
+
+    /**
+     * @brief Averaged frequency in milli-hertz.
+     * @param timerHz capture timer tick rate (timer clock / (PSC + 1)).
+     */
+    [[nodiscard]] u64 frequencyMilli(const u32 timerHz) noexcept {
+        update();
+        if (_filled == 0u || _sum == 0u) {
+            return 0;
+        }
+        // timerHz * 1000 * filled / sum, fits u64 for any u32 timerHz and Window
+        return (static_cast<u64>(timerHz) * 1000u * _filled + _sum / 2u) / _sum;
+    }
+
+    // Averaged frequency in hertz, rounded
+    [[nodiscard]] u32 frequency(const u32 timerHz) noexcept {
+        return static_cast<u32>((frequencyMilli(timerHz) + 500u) / 1000u);
+    }
+
+    // Edges consumed since start()/reset()
+    [[nodiscard]] u32 edges() noexcept {
+        update();
+        return _edges;
+    }
+
+    // Ring laps (reads more than N - 1 edges apart) since start()/reset()
+    [[nodiscard]] u32 overruns() noexcept {
+        update();
+        return _overruns;
+    }
+
+    // Periods currently in the average (saturates at Window)
+    [[nodiscard]] constexpr u16 filled() const noexcept { return _filled; }
+    [[nodiscard]] constexpr bool isRunning() const noexcept { return _running; }
+    [[nodiscard]] static bool isAvailable() noexcept { return Source::isAvailable(); }
+
+private:
+    static constexpr u16 next(const u16 i) noexcept { return static_cast<u16>((i + 1u == N) ? 0u : i + 1u); }
+    static constexpr u16 prev(const u16 i) noexcept { return static_cast<u16>((i == 0u) ? N - 1u : i - 1u); }
+
+    // ring slots from `from` to `to`, in [0, N)
+    static constexpr u16 distance(const u16 from, const u16 to) noexcept {
+        return static_cast<u16>((to >= from) ? to - from : N - from + to);
+    }
+
+    // DMA write position: the sample before it is complete
+    static u16 head() noexcept {
+        const u16 left = Source::remaining();
+        return static_cast<u16>((left == 0u || left >= N) ? 0u : N - left);
+    }
+
+    // drop the average and the reference edge, keep the position and counters
+    void restart() noexcept {
+        _primed = false;
+        _filled = 0;
+        _pos    = 0;
+        _sum    = 0;
+        _last   = 0;
+    }
+
+    void push(const period_t p) noexcept {
+        if (_filled == Window) {
+            _sum -= _window[_pos];
+        } else {
+            ++_filled;
+        }
+        _window[_pos] = p;
+        _sum += p;
+        _pos  = static_cast<u16>((_pos + 1u == Window) ? 0u : _pos + 1u);
+        _last = p;
+    }
+
+private:
+    std::array<volatile sample_t, N> _ring{};   ///< written by DMA
+    std::array<period_t, Window> _window{};     ///< last Window periods
+    u64      _sum    = 0;       ///< sum of _window[0.._filled)
+    period_t _last   = 0;       ///< most recent period
+    u32      _edges  = 0;
+    u32      _overruns = 0;
+    sample_t _prev   = 0;       ///< last consumed timestamp
+    u16      _tail   = 0;       ///< next sample to consume
+    u16      _pos    = 0;       ///< next _window slot
+    u16      _filled = 0;
+    bool     _primed  = false;
+    bool     _running = false;
+};
+
+#endif /* STM32_TOOLS_TIME_CAPTURE_CAPTUREMETER_H_ */
@@ -0,0 +1,84 @@
+/*
+ * HostCapture.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Host stand-in for an input-capture channel with circular DMA
+ */
+
+#ifndef STM32_TOOLS_TIME_CAPTURE_HOSTCAPTURE_H_
+#define STM32_TOOLS_TIME_CAPTURE_HOSTCAPTURE_H_
+
+#include "CaptureMeter.h"
+
+//------------------------------------------------------------------------------
+// HostCapture<Id, Sample, Mask>:
+//   - CaptureMeter Source on plain variables: edge(t) plays the role of the
+//     capture event + DMA transfer (stores t & Mask, advances NDTR)
+//   - feed() / feedPeriodic() push synthetic capture sequences
+//   - Id separates independent channels
+//
+//     using Cap = HostCapture<0>;              // 16-bit counter
+//     CaptureMeter<Cap> meter;
+//     meter.start();
+//     Cap::feedPeriodic(0xFF00, 1000, 20);     // 20 edges, 1000 ticks apart, wraps
+//     meter.average();                         // 1000
+//------------------------------------------------------------------------------
+template<unsigned Id = 0, typename Sample = u16, Sample Mask = std::numeric_limits<Sample>::max()>
+class HostCapture
+{
+    STATIC_CLASS(HostCapture);
+
+public:
+    using sample_t = Sample;
+    static constexpr sample_t mask = Mask;
+
+    static bool start(sample_t* const buf, const u16 n) noexcept {
+        _buf  = buf;
+        _size = n;
+        _left = n;
+        return buf != nullptr && n != 0u;
+    }
+
+    static void stop() noexcept {
+        _buf  = nullptr;
+        _size = 0;
+        _left = 0;
+    }
+
+    [[nodiscard]] static u16 remaining() noexcept { return _left; }
+    [[nodiscard]] static bool isAvailable() noexcept { return true; }
+
+    // One capture event at counter value t
+    static void edge(const u64 t) noexcept {
+        if (_buf == nullptr) {
+            return;
+        }
+        _buf[_size - _left] = static_cast<sample_t>(t & Mask);
+        _left = static_cast<u16>((_left == 1u) ? _size : _left - 1u);
+    }
+
+    // Captures at the given counter values
+    template<typename It>
+    static void feed(It first, const It last) noexcept {
+        for (; first != last; ++first) {
+            edge(static_cast<u64>(*first));
+        }
+    }
+
+    // `count` captures, `period` ticks apart starting at t0; returns the next timestamp
+    static u64 feedPeriodic(u64 t0, const u64 period, const u32 count) noexcept {
+        for (u32 i = 0; i < count; ++i, t0 += period) {
+            edge(t0);
+        }
+        return t0;
+    }
+
+private:
+    static inline sample_t* _buf  = nullptr;
+    static inline u16       _size = 0;
+    static inline u16       _left = 0;
+};
+
+#endif /* STM32_TOOLS_TIME_CAPTURE_HOSTCAPTURE_H_ */
@@ -0,0 +1,252 @@
+/*
+ * CompareTimer.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Interrupt-driven one-shot timers multiplexed on one output-compare channel
+ */
+
+#ifndef STM32_TOOLS_TIME_COMPARE_COMPARETIMER_H_
+#define STM32_TOOLS_TIME_COMPARE_COMPARETIMER_H_
+
+#include "time/lock_policy.h"
+#include <type_traits>
+
+//------------------------------------------------------------------------------
+// Channel contract (all static, see HTimerChannel in HTimer.h):
+//   using type_t                  - counter type (unsigned)
+//   static constexpr type_t mask  - counter modulus - 1 (0xFFFF for 16-bit TIM)
+//   static type_t now()           - free-running counter
+//   static void setCompare(type_t)- write CCR
+//   static void enable()          - enable the CC interrupt
+//   static void disable()         - disable the CC interrupt
+//   static void trigger()         - force a CC event (software-generated match)
+//   static bool isAvailable()     - channel's timer is attached and running
+//
+// A host harness implements the same contract on plain variables.
+//------------------------------------------------------------------------------
+
+template<class Channel> class CompareQueue;
+
+//------------------------------------------------------------------------------
+// CompareTimer<Channel>:
+//   - one-shot node, armed with start(interval), fires from the CC interrupt
+//   - isExpired() returns true exactly once after the interrupt fired it
+//   - optional callback runs in interrupt context
+//   - interval must be <= max_interval (half the counter range)
+//------------------------------------------------------------------------------
+template<class Channel>
+class CompareTimer
+{
+    using Queue = CompareQueue<Channel>;
+    friend Queue;
+
+public:
+    using value_type = typename Channel::type_t;
+    using Callback   = void (*)(CompareTimer&);
+
+    static_assert(std::is_unsigned_v<value_type>, "CompareTimer: Channel::type_t must be unsigned");
+
+    static constexpr value_type half         = static_cast<value_type>((Channel::mask >> 1) + 1u);
+    static constexpr value_type max_interval = half;
+
+    constexpr explicit CompareTimer(const value_type iv = value_type{}, const Callback cb = nullptr) noexcept
+        : _interval(iv), _callback(cb) {}
+
+    ~CompareTimer() { stop(); }
+
+    _DELETE_COPY_MOVE(CompareTimer);
+
+    // Arm with the stored interval from Channel::now(). Returns false if it doesn't fit.
+    bool start() { return Queue::arm(*this, Channel::now(), _interval); }
+
+    // Arm with a new interval
+    bool start(const value_type interval) {
+        _interval = interval;
+        return start();
+    }
+
+    // Arm against an absolute deadline (may already be in the past: fires at once)
+    bool startAt(const value_type deadline) { return Queue::armAt(*this, deadline); }
+
+    // Cancel, no expiry will be reported
+    void stop() { Queue::cancel(*this); }
+
+    // Returns true only once after the interrupt fired this timer
+    [[nodiscard]] bool isExpired() {
+        if (_state != State::Fired) {
+            return false;
+        }
+        _state = State::Idle;
+        return true;
+    }
+
+    [[nodiscard]] bool isPending() const noexcept { return _state == State::Armed; }
+    [[nodiscard]] bool isStopped() const noexcept { return _state == State::Idle; }
+
+    [[nodiscard]] value_type timeLeft() const noexcept {
+        if (_state != State::Armed) {
+            return value_type{0};
+        }
+        const value_type left = static_cast<value_type>((_deadline - Channel::now()) & Channel::mask);
+        return (left > max_interval) ? value_type{0} : left;
+    }
+
+    [[nodiscard]] constexpr value_type getInterval() const noexcept { return _interval; }
+    [[nodiscard]] constexpr value_type deadline() const noexcept { return _deadline; }
+
+    void setCallback(const Callback cb) noexcept { _callback = cb; }
+
+    [[nodiscard]] static bool isAvailable() noexcept { return Channel::isAvailable(); }
+
+private:
+    enum class State : u8 { Idle, Armed, Fired };
+
+    value_type     _deadline = 0;
+    value_type     _interval = 0;
+    CompareTimer*  _next     = nullptr;
+    Callback       _callback = nullptr;
+    volatile State _state    = State::Idle;
+};
+
+//------------------------------------------------------------------------------
+// CompareQueue<Channel>: software multiplexer for one compare channel.
+//   - intrusive list sorted by deadline (wrap-safe modular comparison)
+//   - CCR always holds the head deadline, the interrupt is off when empty
+//   - a deadline already passed when programmed is forced through trigger()
+//
+// Call onCompare() from the channel's compare interrupt.
+//------------------------------------------------------------------------------
+template<class Channel>
+class CompareQueue
+{
+    STATIC_CLASS(CompareQueue);
+
+    using Timer      = CompareTimer<Channel>;
+    using value_type = typename Channel::type_t;
+    using State      = typename Timer::State;
+    friend Timer;
+
+public:
+    // Compare interrupt handler: fires every due timer, programs the next one.
+    // Callbacks run outside TimeLock, so they may re-arm (start()) any timer.
+    static void onCompare() {
+        for (;;) {
+            Timer* fired = nullptr;
+            time_tick_locked([&fired] { fired = popDue(); });
+            if (fired == nullptr) {
+                break;
+            }
+            if (const auto cb = fired->_callback) {
+                cb(*fired);
+            }
+        }
+    }
+
+    // Earliest pending timer (nullptr if none)
+    [[nodiscard]] static const Timer* head() noexcept { return _head; }
+
+private:
+    // (now - deadline) falls into the "after" half of the counter range
+    static constexpr bool isDue(const value_type deadline, const value_type now) noexcept {
+        return static_cast<value_type>((now - deadline) & Channel::mask) < Timer::half;
+    }
+
+    // a before b, valid while both are within half a range of each other
+    static constexpr bool isBefore(const value_type a, const value_type b) noexcept {
+        return static_cast<value_type>((a - b) & Channel::mask) >= Timer::half;
+    }
+
+    // Under TimeLock: unlinks the head if it is due, otherwise programs it
+    // (or disables the interrupt when the queue is empty) and returns nullptr
+    static Timer* popDue() {
+        while (Timer* const head = _head) {
+            if (!isDue(head->_deadline, Channel::now())) {
+                if (program(head->_deadline)) {
+                    return nullptr;     // compare is pending in hardware
+                }
+                continue;               // counter ran past it while programming
+            }
+
+            _head = head->_next;
+            head->_next  = nullptr;
+            head->_state = State::Fired;
+            return head;
+        }
+        Channel::disable();
+        return nullptr;
+    }
+
+    // Write CCR and re-check: returns false if the deadline passed meanwhile
+    static bool program(const value_type deadline) {
+        Channel::setCompare(static_cast<value_type>(deadline & Channel::mask));
+        Channel::enable();
+        return !isDue(deadline, Channel::now());
+    }
+
+    static bool arm(Timer& t, const value_type now, const value_type interval) {
+        if (interval > Timer::max_interval) {
+            return false;
+        }
+        return armAt(t, static_cast<value_type>(now + interval));
+    }
+
+    static bool armAt(Timer& t, const value_type deadline) {
+        TimeLock guard;
+
+        const Timer* const old_head = _head;
+        unlink(t);
+        t._deadline = static_cast<value_type>(deadline & Channel::mask);
+        t._state    = State::Armed;
+
+        // sorted insert, equal deadlines keep arming order
+        Timer** link = &_head;
+        while (*link && !isBefore(t._deadline, (*link)->_deadline)) {
+            link = &(*link)->_next;
+        }
+        t._next = *link;
+        *link   = &t;
+
+        if (_head != old_head || old_head == &t) {
+            reprogram();
+        }
+        return true;
+    }
+
+    static void cancel(Timer& t) {
+        TimeLock guard;
+
+        const bool was_head = (_head == &t);
+        unlink(t);
+        t._state = State::Idle;
+
+        if (was_head) {
+            reprogram();
+        }
+    }
+
+    // Head changed: move CCR to it, or force the interrupt if it's already due
+    static void reprogram() {
+        if (_head == nullptr) {
+            Channel::disable();
+        } else if (!program(_head->_deadline)) {
+            Channel::trigger();
+        }
+    }
+
+    static void unlink(Timer& t) noexcept {
+        for (Timer** link = &_head; *link; link = &(*link)->_next) {
+            if (*link == &t) {
+                *link = t._next;
+                t._next = nullptr;
+                return;
+            }
+        }
+    }
+
+private:
+    static inline Timer* _head = nullptr;  ///< earliest deadline first
+};
+
+#endif /* STM32_TOOLS_TIME_COMPARE_COMPARETIMER_H_ */
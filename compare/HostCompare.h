@@ -0,0 +1,90 @@
+/*
+ * HostCompare.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Host stand-in for an output-compare channel: mock CNT/CCR/DIER registers
+ */
+
+#ifndef STM32_TOOLS_TIME_COMPARE_HOSTCOMPARE_H_
+#define STM32_TOOLS_TIME_COMPARE_HOSTCOMPARE_H_
+
+#include "CompareTimer.h"
+#include <limits>
+
+//------------------------------------------------------------------------------
+// HostCompareChannel<Id, T, Mask>:
+//   - CompareTimer Channel on plain variables: CNT, CCR, the CC interrupt
+//     enable and the CC flag
+//   - step(n) counts n timer clocks; a CNT == CCR match sets the flag, and
+//     with the interrupt enabled the flag runs CompareQueue::onCompare(),
+//     like the CC interrupt on target
+//   - trigger() sets the flag (software-generated match), served on the
+//     next step() or serve()
+//   - Id separates independent channels
+//
+//     using Ch = HostCompareChannel<0>;        // 16-bit counter
+//     CompareTimer<Ch> t(100);
+//     t.start();
+//     Ch::step(100);                           // t.isExpired() == true
+//------------------------------------------------------------------------------
+template<unsigned Id = 0, typename T = u16, T Mask = std::numeric_limits<T>::max()>
+class HostCompareChannel
+{
+    STATIC_CLASS(HostCompareChannel);
+
+public:
+    using type_t = T;
+    static constexpr type_t mask = Mask;
+
+    static inline type_t now() noexcept { return _cnt; }
+    static inline void setCompare(const type_t v) noexcept { _ccr = static_cast<type_t>(v & Mask); }
+    static inline void enable() noexcept { _enabled = true; }
+    static inline void disable() noexcept { _enabled = false; }
+    static inline void trigger() noexcept { _flag = true; }
+    static constexpr inline bool isAvailable() noexcept { return true; }
+
+    // n timer clocks, the compare interrupt served between them
+    static void step(u64 n) {
+        serve();
+        for (; n != 0u; --n) {
+            _cnt = static_cast<type_t>((_cnt + 1u) & Mask);
+            if (_cnt == _ccr) {
+                _flag = true;
+            }
+            serve();
+        }
+    }
+
+    // Runs the compare interrupt if it is flagged and enabled
+    static void serve() {
+        if (_flag && _enabled) {
+            _flag = false;
+            ++_interrupts;
+            CompareQueue<HostCompareChannel>::onCompare();
+        }
+    }
+
+    // Register state, e.g. to start a test just before the counter wraps
+    static void reset(const type_t cnt = 0) noexcept {
+        _cnt        = static_cast<type_t>(cnt & Mask);
+        _ccr        = 0;
+        _enabled    = false;
+        _flag       = false;
+        _interrupts = 0;
+    }
+
+    [[nodiscard]] static type_t compare() noexcept { return _ccr; }
+    [[nodiscard]] static bool isEnabled() noexcept { return _enabled; }
+    [[nodiscard]] static u32 interrupts() noexcept { return _interrupts; }
+
+private:
+    static inline type_t _cnt        = 0;
+    static inline type_t _ccr        = 0;
+    static inline bool   _enabled    = false;
+    static inline bool   _flag       = false;
+    static inline u32    _interrupts = 0;
+};
+
+#endif /* STM32_TOOLS_TIME_COMPARE_HOSTCOMPARE_H_ */
@@ -11,5 +11,7 @@
 // interval ----------------------------
 #include "interval/ITimeBase.h"
 #include "interval/OneShotIBase.h"
+#include "interval/PackedOneShotIBase.h"
+#include "interval/SeqITimeBase.h"
 
 #endif /* STM32_TOOLS_TIME_INTERVAL_H_ */
@@ -0,0 +1,123 @@
+/*
+ * Deadline.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Absolute expiry instant: one timeout budget shared by a whole call chain
+ */
+
+#ifndef STM32_TOOLS_TIME_INTERVAL_DEADLINE_H_
+#define STM32_TOOLS_TIME_INTERVAL_DEADLINE_H_
+
+#include "time/interval_depency.h"
+#include <limits>
+#include <type_traits>
+
+//------------------------------------------------------------------------------
+// Deadline<Policy>:
+//   - one word: the absolute instant (Policy::now() units) the budget runs out
+//   - created once at the top of a transaction and passed down by value;
+//     nested calls test the same instant instead of stacking fresh relative
+//     timeouts, so the total can never exceed the outer budget
+//   - expired(): one clock read, one subtraction, one compare
+//   - comparisons are wrap-safe: budgets must be shorter than half the range
+//     of Policy::type_t (Tick: ~24 days)
+//   - dynamic timer adapters of the same Policy convert from it implicitly:
+//     TickITimer<> t = dl;  OneShotITick<> o = dl;  (armed to the remaining budget)
+//
+//     bool readReg(Deadline<Tick> dl) {
+//         while (!i2cReady()) { if (dl.expired()) return false; }
+//         ...
+//     }
+//     bool readSensor(Deadline<Tick> dl) {
+//         return readReg(dl.cap(5))          // at most 5 ms, never past dl
+//             && readReg(dl.cap(5))
+//             && readReg(dl);
+//     }
+//     readSensor(Deadline<Tick>::in(20));    // whole read: 20 ms, not 3 x 20
+//------------------------------------------------------------------------------
+template<class Policy>
+class Deadline
+{
+public:
+    using value_type = typename Policy::type_t;
+
+    static_assert(std::is_integral_v<value_type> && std::is_unsigned_v<value_type>,
+                  "Deadline: Policy::type_t must be unsigned (wrap-around arithmetic)");
+
+    // `timeout` ticks from now
+    [[nodiscard]] static Deadline in(const value_type timeout) noexcept(noexcept(Policy::now())) {
+        return Deadline(static_cast<value_type>(Policy::now() + timeout));
+    }
+
+    // `timeout` ticks from a known `now` (no clock read)
+    [[nodiscard]] static constexpr Deadline in(const value_type timeout, const value_type now) noexcept {
+        return Deadline(static_cast<value_type>(now + timeout));
+    }
+
+    // Absolute instant
+    [[nodiscard]] static constexpr Deadline at(const value_type instant) noexcept {
+        return Deadline(instant);
+    }
+
+    // The earlier of two budgets
+    [[nodiscard]] static constexpr Deadline min(const Deadline a, const Deadline b) noexcept {
+        return isBefore(b._at, a._at) ? b : a;
+    }
+
+    // The later of two budgets
+    [[nodiscard]] static constexpr Deadline max(const Deadline a, const Deadline b) noexcept {
+        return isBefore(a._at, b._at) ? b : a;
+    }
+
+    // This budget, but at most `timeout` ticks from now
+    [[nodiscard]] Deadline cap(const value_type timeout) const noexcept(noexcept(Policy::now())) {
+        return min(*this, in(timeout));
+    }
+
+    [[nodiscard]] bool expired() const noexcept(noexcept(Policy::now())) {
+        return expired(Policy::now());
+    }
+
+    [[nodiscard]] constexpr bool expired(const value_type now) const noexcept {
+        return !isBefore(now, _at);
+    }
+
+    // Ticks left, 0 once expired
+    [[nodiscard]] value_type remaining() const noexcept(noexcept(Policy::now())) {
+        return remaining(Policy::now());
+    }
+
+    [[nodiscard]] constexpr value_type remaining(const value_type now) const noexcept {
+        return isBefore(now, _at) ? static_cast<value_type>(_at - now) : value_type{0};
+    }
+
+    // Ticks past the instant, 0 while running
+    [[nodiscard]] constexpr value_type overdue(const value_type now) const noexcept {
+        return isBefore(now, _at) ? value_type{0} : static_cast<value_type>(now - _at);
+    }
+
+    [[nodiscard]] constexpr value_type instant() const noexcept { return _at; }
+
+    friend constexpr bool operator==(const Deadline a, const Deadline b) noexcept { return a._at == b._at; }
+    friend constexpr bool operator!=(const Deadline a, const Deadline b) noexcept { return a._at != b._at; }
+    friend constexpr bool operator<(const Deadline a, const Deadline b) noexcept { return isBefore(a._at, b._at); }
+    friend constexpr bool operator>(const Deadline a, const Deadline b) noexcept { return isBefore(b._at, a._at); }
+
+private:
+    constexpr explicit Deadline(const value_type instant) noexcept : _at(instant) {}
+
+    static constexpr value_type half =
+        static_cast<value_type>(std::numeric_limits<value_type>::max() / 2u + 1u);
+
+    // a strictly before b, modulo the type range
+    static constexpr bool isBefore(const value_type a, const value_type b) noexcept {
+        return static_cast<value_type>(a - b) >= half;
+    }
+
+private:
+    value_type _at;
+};
+
+#endif /* STM32_TOOLS_TIME_INTERVAL_DEADLINE_H_ */
@@ -9,18 +9,47 @@
 #define STM32_TOOLS_TIME_INTERVAL_ITIMEBASE_H_
 
 #include "StackITimer.h"     // unified StackITimer template
+#include "time/scheduler/Slack.h"
+#include "Deadline.h"
 
 //------------------------------------------------------------------------------
 // ITimeBase<Interval, Policy>
 //  - thin adapter around StackITimer that calls Policy::now() internally
 //  - maximized for inlining and compile-time checking
+//  - IntervalPolicy: see StackITimer (e.g. RtoIntervalPolicy for retries)
+//  - Stretchable (dynamic only, off by default; alias SlackITimeBase): one
+//    extra word of ticks added to the current period only (nextWithSlack(),
+//    expireIn()), cleared by every next(). Without it the footprint is the
+//    StackITimer's alone.
 //------------------------------------------------------------------------------
 
-template<auto Interval, class Policy>
-class ITimeBase : public StackITimer<Interval, typename Policy::type_t>
+namespace itime_detail {
+    // plain and static timers: no stretch, no storage (empty base)
+    template<typename T, bool Stretchable>
+    struct PeriodStretch {
+        static constexpr T stretch() noexcept { return T{0}; }
+        constexpr void setStretch(const T) noexcept {}
+    };
+
+    template<typename T>
+    struct PeriodStretch<T, true> {
+        constexpr T stretch() const noexcept { return _stretch; }
+        constexpr void setStretch(const T s) noexcept { _stretch = s; }
+    private:
+        T _stretch = 0;
+    };
+} /* namespace itime_detail */
+
+template<auto Interval, class Policy,
+         class IntervalPolicy = default_interval_policy_t<Interval, typename Policy::type_t>,
+         bool Stretchable = false>
+class ITimeBase : public StackITimer<Interval, typename Policy::type_t, IntervalPolicy>,
+                  private itime_detail::PeriodStretch<typename Policy::type_t,
+                                                      Stretchable && StackITimer<Interval, typename Policy::type_t, IntervalPolicy>::is_dynamic_interval>
 {
     using type_t = typename Policy::type_t;
-    using Base = StackITimer<Interval, type_t>;
+    using Base = StackITimer<Interval, type_t, IntervalPolicy>;
+    using Stretch = itime_detail::PeriodStretch<type_t, Stretchable && Base::is_dynamic_interval>;
 
     static_assert(std::is_integral_v<type_t>,
                   "ITimeBase: Policy::type_t must be an integral type");
@@ -41,6 +70,7 @@ class ITimeBase : public StackITimer<Interval, typename Policy::type_t>
 public:
     // expose type to users
     using value_type = type_t;
+    static constexpr bool is_stretchable = Stretchable && Base::is_dynamic_interval;
 
     // 1) DYNAMIC (Interval == 0):
     //    - Accepts an initial interval for the runtime policy.
@@ -59,6 +89,14 @@ public:
     ITimeBase() noexcept(noexcept(Policy::now()))
         : Base() { next(); }  // auto-start
 
+    // 3) DEADLINE (Interval == 0, unsigned type):
+    //    - Implicit: a Deadline<Policy> budget becomes a timer armed for what is left of it.
+    //      One Policy::now() read; an expired budget gives an already expired timer.
+    template<auto I = Interval, typename U = value_type,
+             std::enable_if_t<(I == U{0}) && std::is_unsigned_v<U>, int> = 0>
+    ITimeBase(const Deadline<Policy>& deadline) noexcept(noexcept(Policy::now()))
+        : Base(U{}) { next(deadline); }
+
     // Delete assignment-from-value inherited from StackITimer on purpose:
     // user must call next()/start() explicitly, not assign accidentally.
     ITimeBase& operator=(const value_type) = delete;
@@ -72,18 +110,31 @@ public:
     // Check if the interval has expired isExpired() -> uses Policy::now() internally
     [[nodiscard]]
     constexpr bool isExpired() const noexcept(noexcept(Policy::now())) {
-        return Base::isExpired(Policy::now());
+        return isExpired(Policy::now());
+    }
+
+    [[nodiscard]]
+    constexpr bool isExpired(const value_type now) const noexcept {
+        return Base::elapsed(now) >= period();
     }
 
     // get time left timeLeft() -> uses Policy::now()
     [[nodiscard]]
     constexpr value_type timeLeft() const noexcept(noexcept(Policy::now())) {
-        return Base::timeLeft(Policy::now());
+        return timeLeft(Policy::now());
+    }
+
+    [[nodiscard]]
+    constexpr value_type timeLeft(const value_type now) const noexcept {
+        const value_type elapsed = Base::elapsed(now);
+        const value_type total   = period();
+        return (elapsed >= total) ? value_type{0} : static_cast<value_type>(total - elapsed);
     }
 
     // next() -> Restart the timer from now
     constexpr void next() noexcept(noexcept(Policy::now())) {
         Base::next(Policy::now());
+        Stretch::setStretch(value_type{0});
     }
 
     // next(now, interval) replacement: restart+set interval (only for dynamic)
@@ -94,15 +145,86 @@ public:
                           "ITimeBase::next(interval): cannot set interval on static timer");
         } else {
             Base::next(Policy::now(), newInterval);
+            Stretch::setStretch(value_type{0});
         }
     }
 
+    // Restart to expire at `deadline` (dynamic only)
+    template<typename U = value_type, std::enable_if_t<std::is_unsigned_v<U>, int> = 0>
+    constexpr void next(const Deadline<Policy>& deadline) noexcept(noexcept(Policy::now())) {
+        if constexpr (Base::is_static_interval) {
+            static_assert(!Base::is_static_interval,
+                          "ITimeBase::next(deadline): cannot set interval on static timer");
+        } else {
+            const value_type now = Policy::now();
+            Base::next(now, deadline.remaining(now));
+            Stretch::setStretch(value_type{0});
+        }
+    }
+
+    // Expiry of the running interval as an absolute budget to pass down a call chain
+    template<typename U = value_type, std::enable_if_t<std::is_unsigned_v<U>, int> = 0>
+    [[nodiscard]]
+    Deadline<Policy> deadline() const noexcept(noexcept(Policy::now())) {
+        const value_type now = Policy::now();
+        return Deadline<Policy>::in(timeLeft(now), now);
+    }
+
+    // Restart with `newInterval`, allowing expiry up to `slack` ticks late (dynamic only).
+    // This period ends on the most aligned instant of [now + newInterval, +slack]
+    // (Slack::align), so timers with overlapping windows expire on the same tick.
+    // getInterval() stays newInterval, the next next() runs an unstretched period.
+    // SlackITimeBase only.
+    constexpr void nextWithSlack(const value_type newInterval, const value_type slack) noexcept(noexcept(Policy::now())) {
+        if constexpr (Base::is_static_interval) {
+            static_assert(!Base::is_static_interval,
+                          "ITimeBase::nextWithSlack: cannot stretch the interval of a static timer");
+        } else if constexpr (!Stretchable) {
+            static_assert(Stretchable, "ITimeBase::nextWithSlack: needs the stretch word, use SlackITimeBase");
+        } else {
+            const value_type now  = Policy::now();
+            const value_type fire = Slack::align(static_cast<value_type>(now + newInterval), slack);
+            Base::next(now, newInterval);
+            Stretch::setStretch(static_cast<value_type>(fire - now - newInterval));
+        }
+    }
+
+    // End the current period `left` ticks after now, interval unchanged (dynamic only):
+    // a shorter period moves the stamp back, a longer one is stretched. SlackITimeBase only.
+    constexpr void expireIn(const value_type now, const value_type left) noexcept {
+        if constexpr (Base::is_static_interval) {
+            static_assert(!Base::is_static_interval,
+                          "ITimeBase::expireIn: cannot stretch the interval of a static timer");
+        } else if constexpr (!Stretchable) {
+            static_assert(Stretchable, "ITimeBase::expireIn: needs the stretch word, use SlackITimeBase");
+        } else {
+            const value_type iv = Base::getInterval();
+            if (left <= iv) {
+                Base::next(static_cast<value_type>(now - (iv - left)));
+                Stretch::setStretch(value_type{0});
+            } else {
+                Base::next(now);
+                Stretch::setStretch(static_cast<value_type>(left - iv));
+            }
+        }
+    }
 
     // elapsed ticks since last reset using Policy::now()
     [[nodiscard]]
     constexpr value_type elapsed() const noexcept(noexcept(Policy::now())) {
         return Base::elapsed(Policy::now());
     }
+
+private:
+    // length of the current period: interval + stretch
+    constexpr value_type period() const noexcept {
+        return static_cast<value_type>(Base::getInterval() + Stretch::stretch());
+    }
 };
 
+// Dynamic ITimeBase with the per-period stretch word: nextWithSlack(), expireIn()
+template<auto Interval, class Policy,
+         class IntervalPolicy = default_interval_policy_t<Interval, typename Policy::type_t>>
+using SlackITimeBase = ITimeBase<Interval, Policy, IntervalPolicy, true>;
+
 #endif /* STM32_TOOLS_TIME_INTERVAL_ITIMEBASE_H_ */
@@ -9,16 +9,18 @@
 #define STM32_TOOLS_TIME_INTERVAL_ONESHOTIBASE_H_
 
 #include "OneShotITimer.h"     // unified StackITimer template
+#include "Deadline.h"
 #include <utility>
 
 //------------------------------------------------------------------------------
-// ITimeBase<Interval, Policy>:
+// OneShotIBase<Interval, Policy, IntervalPolicy>:
 //------------------------------------------------------------------------------
-template<auto Interval, class Policy>
-class OneShotIBase : public OneShotITimer<Interval, typename Policy::type_t>
+template<auto Interval, class Policy,
+         class IntervalPolicy = default_interval_policy_t<Interval, typename Policy::type_t>>
+class OneShotIBase : public OneShotITimer<Interval, typename Policy::type_t, IntervalPolicy>
 {
     using type_t = typename Policy::type_t;
-    using Base = OneShotITimer<Interval, type_t>;
+    using Base = OneShotITimer<Interval, type_t, IntervalPolicy>;
 
     static_assert(std::is_integral_v<type_t>,
                   "OneShotIBase: Policy::type_t must be integral");
@@ -42,6 +44,12 @@ public:
     // Inherit constructor: in dynamic mode, initial interval can be passed; ignored in static mode
     using Base::Base;
 
+    // Implicit from a Deadline<Policy> budget (dynamic only): started, expires with the budget
+    template<auto I = Interval, typename U = value_type,
+             std::enable_if_t<(I == U{0}) && std::is_unsigned_v<U>, int> = 0>
+    OneShotIBase(const Deadline<Policy>& deadline) noexcept(noexcept(Policy::now()))
+        : Base(U{}) { start(deadline); }
+
     // forbid accidental assignment-from-time
     OneShotIBase& operator=(const value_type) = delete;
 
@@ -75,6 +83,21 @@ public:
         Base::start(Policy::now(), interval);
     }
 
+    // Explicit start, expiring at `deadline` (dynamic only)
+    template<typename U = value_type, std::enable_if_t<std::is_unsigned_v<U>, int> = 0>
+    constexpr void start(const Deadline<Policy>& deadline) noexcept(noexcept(Policy::now())) {
+        const value_type now = Policy::now();
+        Base::start(now, deadline.remaining(now));
+    }
+
+    // Expiry as an absolute budget (meaningful while started)
+    template<typename U = value_type, std::enable_if_t<std::is_unsigned_v<U>, int> = 0>
+    [[nodiscard]]
+    Deadline<Policy> deadline() const noexcept(noexcept(Policy::now())) {
+        const value_type now = Policy::now();
+        return Deadline<Policy>::in(Base::timeLeft(now), now);
+    }
+
 
     /*
      * StackITimer interface
@@ -15,13 +15,15 @@
 //   - OneShotITimer<>          => dynamic (interval set at runtime)
 //   - OneShotITimer<100u>      => static interval = 100
 //   - Default interval type    => unsigned int
+//   - OneShotITimer<0u, T, P>  => custom runtime interval policy P
 //------------------------------------------------------------------------------
 
-template<auto Interval = 0u, typename T = reg>
+template<auto Interval = 0u, typename T = reg,
+         class IntervalPolicy = default_interval_policy_t<Interval, T>>
 class OneShotITimer
-    : public StackITimer<Interval, T>
+    : public StackITimer<Interval, T, IntervalPolicy>
 {
-    using Base = StackITimer<Interval, T>;
+    using Base = StackITimer<Interval, T, IntervalPolicy>;
 
 public:
     // expose type to users
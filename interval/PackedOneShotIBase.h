@@ -0,0 +1,94 @@
+/*
+ * PackedOneShotIBase.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ */
+
+#ifndef STM32_TOOLS_TIME_INTERVAL_PACKEDONESHOTIBASE_H_
+#define STM32_TOOLS_TIME_INTERVAL_PACKEDONESHOTIBASE_H_
+
+#include "PackedOneShotITimer.h"
+
+//------------------------------------------------------------------------------
+// PackedOneShotIBase<Interval, Policy, Storage, Store>
+//  - adapter over PackedOneShotITimer that pulls time from Policy::now()
+//  - Storage defaults to Policy::type_t, pass u16 for half-word timers
+//------------------------------------------------------------------------------
+template<auto Interval, class Policy,
+         typename Storage = typename Policy::type_t,
+         PackedStore Store = PackedStore::LastTime>
+class PackedOneShotIBase
+    : public PackedOneShotITimer<Interval, typename Policy::type_t, Storage, Store>
+{
+    using type_t = typename Policy::type_t;
+    using Base = PackedOneShotITimer<Interval, type_t, Storage, Store>;
+
+    static_assert(std::is_integral_v<type_t>,
+                  "PackedOneShotIBase: Policy::type_t must be integral");
+
+    // Policy::now() must exist and be convertible to type_t
+    template<class P>
+    static constexpr auto has_now_impl(int) -> std::bool_constant<
+        std::is_convertible_v<decltype(P::now()), type_t>
+         && noexcept(P::now())
+    >;
+    template<class>
+    static constexpr std::false_type has_now_impl(...);
+    static_assert(decltype(has_now_impl<Policy>(0))::value,
+                  "PackedOneShotIBase: Policy must provide static now() convertible to type_t (or optional noexcept)");
+
+public:
+    // expose type to users
+    using value_type = type_t;
+
+    // Inherit constructor: in dynamic mode, initial interval can be passed
+    using Base::Base;
+
+    // forbid accidental assignment-from-time
+    PackedOneShotIBase& operator=(const value_type) = delete;
+
+    /*
+     * PackedOneShotITimer interface
+     */
+
+    // Return true only once when expired (Base mutates internal state)
+    [[nodiscard]]
+    constexpr bool isExpired() noexcept(noexcept(Policy::now())) {
+        return Base::isExpired(Policy::now());
+    }
+
+    // Restart from now (doesn't auto-start)
+    constexpr void next() noexcept(noexcept(Policy::now())) {
+        Base::next(Policy::now());
+    }
+
+    // Restart + set interval (delegates to Base to keep its compile-time checks)
+    // false: interval saturated to max_interval
+    constexpr bool next(const value_type interval) noexcept(noexcept(Policy::now())) {
+        return Base::next(Policy::now(), interval);
+    }
+
+    // Explicit start
+    constexpr void start() noexcept(noexcept(Policy::now())) {
+        Base::start(Policy::now());
+    }
+
+    // Explicit start + set interval (false: interval saturated to max_interval)
+    constexpr bool start(const value_type interval) noexcept(noexcept(Policy::now())) {
+        return Base::start(Policy::now(), interval);
+    }
+
+    // Time left / elapsed with now()
+    [[nodiscard]]
+    constexpr value_type timeLeft() const noexcept(noexcept(Policy::now())) {
+        return Base::timeLeft(Policy::now());
+    }
+
+    [[nodiscard]]
+    constexpr value_type elapsed() const noexcept(noexcept(Policy::now())) {
+        return Base::elapsed(Policy::now());
+    }
+};
+
+#endif /* STM32_TOOLS_TIME_INTERVAL_PACKEDONESHOTIBASE_H_ */
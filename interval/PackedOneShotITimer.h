@@ -0,0 +1,241 @@
+/*
+ * PackedOneShotITimer.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Compact one-shot interval timer: state bits live in the stored time word
+ */
+
+#ifndef STM32_TOOLS_TIME_INTERVAL_PACKEDONESHOTITIMER_H_
+#define STM32_TOOLS_TIME_INTERVAL_PACKEDONESHOTITIMER_H_
+
+#include "time/interval_policy.h"
+#include <limits>
+#include <utility>
+
+//------------------------------------------------------------------------------
+// What the stored word means
+//   - LastTime => time of the last start/next (same as OneShotITimer)
+//   - Deadline => absolute expiry instant (start time + interval)
+//------------------------------------------------------------------------------
+enum class PackedStore : u8 {
+    LastTime,
+    Deadline
+};
+
+//------------------------------------------------------------------------------
+// PackedOneShotITimer<Interval, T, Storage, Store>:
+//   - same semantics as OneShotITimer<Interval, T>
+//   - `_started`/`_expired` are the two top bits of one Storage word,
+//     the remaining bits hold the time modulo 2^(bits - 2)
+//   - Storage may be narrower than T (e.g. u16 against a u32 clock): time is
+//     kept relative, so it works as long as the interval fits the time field
+//   - dynamic interval is kept in Storage width as well; a runtime interval
+//     above max_interval saturates to it and start()/next() return false
+//     (the timer would fire early), fits(iv) checks beforehand
+//
+//   Wrap-around: a started timer must be polled at least once within
+//   2^(bits - 2) ticks (LastTime) or 2^(bits - 3) ticks (Deadline) after
+//   expiry, otherwise the latched expiry can be missed. This is the same rule
+//   as for StackITimer, only on the reduced time field.
+//------------------------------------------------------------------------------
+
+template<auto Interval = 0u, typename T = reg, typename Storage = T,
+         PackedStore Store = PackedStore::LastTime>
+class PackedOneShotITimer
+    : public std::conditional_t<(Interval == T{0}),
+                                DynamicIntervalPolicy<Storage>,
+                                StaticIntervalPolicy<T, Interval>>
+{
+    using Policy = std::conditional_t<(Interval == T{0}),
+                                      DynamicIntervalPolicy<Storage>,
+                                      StaticIntervalPolicy<T, Interval>>;
+
+    static_assert(std::is_integral_v<T> && std::is_unsigned_v<T>,
+                  "PackedOneShotITimer: T must be unsigned integral");
+    static_assert(std::is_integral_v<Storage> && std::is_unsigned_v<Storage>,
+                  "PackedOneShotITimer: Storage must be unsigned integral");
+    static_assert(sizeof(Storage) <= sizeof(T),
+                  "PackedOneShotITimer: Storage must not be wider than T");
+
+    static constexpr unsigned storage_bits = std::numeric_limits<Storage>::digits;
+
+    // bit layout of the stored word
+    static constexpr Storage started_bit = Storage(Storage{1} << (storage_bits - 1));
+    static constexpr Storage expired_bit = Storage(Storage{1} << (storage_bits - 2));
+    static constexpr Storage state_mask  = Storage(started_bit | expired_bit);
+    static constexpr Storage time_mask   = Storage(~state_mask);
+
+public:
+    // expose type to users
+    using value_type   = T;
+    using storage_type = Storage;
+
+    static constexpr bool is_static_interval  = (Interval != T{0});
+    static constexpr bool is_dynamic_interval = !is_static_interval;
+    static constexpr bool is_deadline         = (Store == PackedStore::Deadline);
+
+    // Longest interval representable in the time field.
+    // Deadline mode splits the field into "before" and "after" halves.
+    static constexpr T max_interval = is_deadline
+        ? static_cast<T>((time_mask >> 1) + 1u)
+        : static_cast<T>(time_mask);
+
+    static_assert(!is_static_interval
+                  || static_cast<unsigned long long>(Interval)
+                         <= static_cast<unsigned long long>(max_interval),
+                  "PackedOneShotITimer: Interval does not fit into the packed time field");
+
+    // true if `iv` is representable (not saturated to max_interval)
+    [[nodiscard]] static constexpr bool fits(const value_type iv) noexcept { return iv <= max_interval; }
+
+    // Dynamic mode ctor: user provides initial interval 'iv' (saturated to max_interval, see fits())
+    template<auto I = Interval, typename U = value_type,
+             std::enable_if_t<(I == U{0}), int> = 0>
+    constexpr explicit PackedOneShotITimer(const U iv = U{}) noexcept
+        : Policy(clamp(iv)) {}
+
+    // Static mode ctor: no parameter
+    template<auto I = Interval, typename U = value_type,
+             std::enable_if_t<(I != U{0}), int> = 0>
+    constexpr PackedOneShotITimer() noexcept
+        : Policy() {}
+
+    [[nodiscard]] constexpr value_type getInterval() const noexcept {
+        return static_cast<value_type>(Policy::getInterval());
+    }
+
+    /*
+     * StackITimer interface
+     */
+
+    // Returns true only once, when the interval has expired.
+    // Note: not const because it latches the expired bit.
+    [[nodiscard]] constexpr bool isExpired(const value_type now) noexcept {
+        if ((_word & state_mask) != started_bit) {
+            return false;
+        }
+        if (due(now)) {
+            _word = Storage(_word | expired_bit);
+            return true;
+        }
+        return false;
+    }
+
+    [[nodiscard]] constexpr value_type timeLeft(const value_type now) const noexcept {
+        if (due(now)) {
+            return value_type{0};
+        }
+        if constexpr (is_deadline) {
+            return static_cast<value_type>(Storage(_word - Storage(now)) & time_mask);
+        } else {
+            return getInterval() - elapsed(now);
+        }
+    }
+
+    // Elapsed ticks since last start/next (modulo the time field)
+    [[nodiscard]] constexpr value_type elapsed(const value_type now) const noexcept {
+        Storage last = _word;
+        if constexpr (is_deadline) {
+            last = Storage(last - Storage(Policy::getInterval()));
+        }
+        return static_cast<value_type>(Storage(Storage(now) - last) & time_mask);
+    }
+
+    // Restart from now — keeps the started bit, you still start explicitly.
+    constexpr void next(const value_type now) noexcept {
+        stamp(now, Storage(_word & started_bit));
+    }
+
+    // Restart + set interval — compile-time error for static interval.
+    // Returns false if `interval` was saturated to max_interval.
+    constexpr bool next(const value_type now, const value_type interval) noexcept {
+        if constexpr (is_static_interval) {
+            static_assert(!is_static_interval,
+                          "Cannot set interval on a static PackedOneShotITimer");
+            return false;
+        } else {
+            Policy::setInterval(clamp(interval));
+            stamp(now, Storage(_word & started_bit));
+            return fits(interval);
+        }
+    }
+
+    // Start (explicit): stamps time and marks started.
+    constexpr void start(const value_type now) noexcept {
+        stamp(now, started_bit);
+    }
+
+    // Start + set interval (compile-time error for static interval).
+    // Returns false if `interval` was saturated to max_interval.
+    constexpr bool start(const value_type now, const value_type interval) noexcept {
+        if constexpr (is_static_interval) {
+            static_assert(!is_static_interval,
+                          "Cannot set interval on a static PackedOneShotITimer");
+            return false;
+        } else {
+            Policy::setInterval(clamp(interval));
+            stamp(now, started_bit);
+            return fits(interval);
+        }
+    }
+
+    /*
+     * OneShotITimer interface
+     */
+
+    constexpr void stop() noexcept {
+        _word = Storage((_word & time_mask) | expired_bit);
+    }
+
+    [[nodiscard]] constexpr bool isStopped() const noexcept { return !(_word & started_bit); }
+
+    // Convenience assignment (does not change started state)
+    constexpr PackedOneShotITimer& operator=(const value_type now) noexcept {
+        next(now);
+        return *this;
+    }
+
+    [[nodiscard]] static constexpr bool isAvailable() noexcept { return true; }
+
+private:
+    // (now - stamp) falls into the "expired" region of the time field
+    [[nodiscard]] constexpr bool due(const value_type now) const noexcept {
+        if constexpr (is_deadline) {
+            return (Storage(Storage(now) - _word) & time_mask) < max_interval;
+        } else {
+            return elapsed(now) >= getInterval();
+        }
+    }
+
+    // write time field + state bits (expired bit always cleared)
+    constexpr void stamp(const value_type now, const Storage state) noexcept {
+        Storage t = Storage(now);
+        if constexpr (is_deadline) {
+            t = Storage(t + Storage(Policy::getInterval()));
+        }
+        _word = Storage((t & time_mask) | state);
+    }
+
+    static constexpr Storage clamp(const value_type iv) noexcept {
+        return static_cast<Storage>((iv > max_interval) ? max_interval : iv);
+    }
+
+private:
+    Storage _word = expired_bit;   ///< [started | expired | time field]
+};
+
+// One word for static timers, two narrow words for dynamic ones
+static_assert(sizeof(PackedOneShotITimer<1u, u32>) == sizeof(u32),
+              "PackedOneShotITimer: static u32 timer must be a single word");
+static_assert(sizeof(PackedOneShotITimer<1u, u32, u16>) == sizeof(u16),
+              "PackedOneShotITimer: static u16-storage timer must be a single half-word");
+static_assert(sizeof(PackedOneShotITimer<0u, u32>) == 2 * sizeof(u32),
+              "PackedOneShotITimer: dynamic u32 timer must be two words");
+static_assert(sizeof(PackedOneShotITimer<0u, u32, u16>) == 2 * sizeof(u16),
+              "PackedOneShotITimer: dynamic u16-storage timer must be two half-words");
+static_assert(sizeof(PackedOneShotITimer<1u, u32, u32, PackedStore::Deadline>) == sizeof(u32),
+              "PackedOneShotITimer: static deadline timer must be a single word");
+
+#endif /* STM32_TOOLS_TIME_INTERVAL_PACKEDONESHOTITIMER_H_ */
@@ -0,0 +1,71 @@
+/*
+ * SeqITimeBase.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ */
+
+#ifndef STM32_TOOLS_TIME_INTERVAL_SEQITIMEBASE_H_
+#define STM32_TOOLS_TIME_INTERVAL_SEQITIMEBASE_H_
+
+#include "SeqITimer.h"
+
+//------------------------------------------------------------------------------
+// SeqITimeBase<Interval, Policy>
+//  - ITimeBase over SeqITimer: calls Policy::now() internally
+//  - next() from one context, isExpired()/timeLeft()/elapsed() from any
+//------------------------------------------------------------------------------
+template<auto Interval, class Policy>
+class SeqITimeBase : public SeqITimer<Interval, typename Policy::type_t>
+{
+    using type_t = typename Policy::type_t;
+    using Base = SeqITimer<Interval, type_t>;
+
+    static_assert(std::is_integral_v<type_t>,
+                  "SeqITimeBase: Policy::type_t must be an integral type");
+
+public:
+    using value_type = type_t;
+
+    // Dynamic: initial interval, armed from now
+    template<auto I = Interval, typename U = value_type,
+             std::enable_if_t<(I == U{0}), int> = 0>
+    explicit SeqITimeBase(const U iv = U{}) noexcept(noexcept(Policy::now()))
+        : Base(iv) { next(); }
+
+    // Static: armed from now
+    template<auto I = Interval, typename U = value_type,
+             std::enable_if_t<(I != U{0}), int> = 0>
+    SeqITimeBase() noexcept(noexcept(Policy::now()))
+        : Base() { next(); }
+
+    SeqITimeBase& operator=(const value_type) = delete;
+
+    [[nodiscard]] bool isExpired() const noexcept(noexcept(Policy::now())) {
+        return Base::isExpired(Policy::now());
+    }
+
+    [[nodiscard]] value_type timeLeft() const noexcept(noexcept(Policy::now())) {
+        return Base::timeLeft(Policy::now());
+    }
+
+    [[nodiscard]] value_type elapsed() const noexcept(noexcept(Policy::now())) {
+        return Base::elapsed(Policy::now());
+    }
+
+    void next() noexcept(noexcept(Policy::now())) {
+        Base::next(Policy::now());
+    }
+
+    // restart + set interval (dynamic only)
+    void next(const value_type newInterval) noexcept(noexcept(Policy::now())) {
+        if constexpr (Base::is_static_interval) {
+            static_assert(!Base::is_static_interval,
+                          "SeqITimeBase::next(interval): cannot set interval on static timer");
+        } else {
+            Base::next(Policy::now(), newInterval);
+        }
+    }
+};
+
+#endif /* STM32_TOOLS_TIME_INTERVAL_SEQITIMEBASE_H_ */
@@ -0,0 +1,237 @@
+/*
+ * SeqITimer.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Interval timer with tear-free state for one writer and any number of readers
+ */
+
+#ifndef STM32_TOOLS_TIME_INTERVAL_SEQITIMER_H_
+#define STM32_TOOLS_TIME_INTERVAL_SEQITIMER_H_
+
+#include "time/interval_depency.h"
+#include <array>
+#include <atomic>
+#include <limits>
+#include <type_traits>
+
+//------------------------------------------------------------------------------
+// Fences of the sequence counter. A single-core target only has to keep the
+// compiler from reordering (interrupts see program order); host builds and
+// -DTIME_SEQ_SMP=1 (multi-core shared memory) use hardware fences.
+//------------------------------------------------------------------------------
+namespace seq_detail {
+
+#if defined(TIME_HOST_BUILD) || (defined(TIME_SEQ_SMP) && TIME_SEQ_SMP)
+inline void fenceRelease() noexcept { std::atomic_thread_fence(std::memory_order_release); }
+inline void fenceAcquire() noexcept { std::atomic_thread_fence(std::memory_order_acquire); }
+#else
+inline void fenceRelease() noexcept { std::atomic_signal_fence(std::memory_order_release); }
+inline void fenceAcquire() noexcept { std::atomic_signal_fence(std::memory_order_acquire); }
+#endif
+
+// T as relaxed atomic words: one std::atomic<T> where that is lock-free
+// (u64 on 64-bit hosts), u32 words otherwise (u64 on Cortex-M, which would
+// otherwise go through a locking libatomic call). Tearing between words is
+// detected by the sequence counter, not prevented here.
+template<typename T>
+class Words
+{
+    static constexpr bool native = std::atomic<T>::is_always_lock_free;
+    static constexpr u8   count  = static_cast<u8>((sizeof(T) + sizeof(u32) - 1u) / sizeof(u32));
+
+public:
+    void store(const T v) noexcept {
+        if constexpr (native) {
+            _v.store(v, std::memory_order_relaxed);
+        } else {
+            for (u8 i = 0; i < count; ++i) {
+                _v[i].store(static_cast<u32>(v >> (32u * i)), std::memory_order_relaxed);
+            }
+        }
+    }
+
+    [[nodiscard]] T load() const noexcept {
+        if constexpr (native) {
+            return _v.load(std::memory_order_relaxed);
+        } else {
+            T v = 0;
+            for (u8 i = 0; i < count; ++i) {
+                v |= static_cast<T>(static_cast<T>(_v[i].load(std::memory_order_relaxed)) << (32u * i));
+            }
+            return v;
+        }
+    }
+
+private:
+    std::conditional_t<native, std::atomic<T>, std::array<std::atomic<u32>, count>> _v{};
+};
+
+} /* namespace seq_detail */
+
+//------------------------------------------------------------------------------
+// SeqITimer<Interval, T>:
+//   - same interface as StackITimer<Interval, T>; next() is the writer, all
+//     const members are readers
+//   - state (last time, dynamic interval) is published through a sequence
+//     counter over two copies (latch): the writer updates copy 0 while the
+//     counter is odd and copy 1 while it is even, readers take the copy the
+//     counter does not point the writer at
+//   - readers never wait for the writer: an ISR that preempts next() halfway
+//     reads the untouched copy in one pass. A reader preempted by the writer
+//     repeats once after the writer is done.
+//   - no interrupt masking, no RMW instructions (Cortex-M0 too)
+//
+// Only one context may write (next) at a time; readers: any context.
+//------------------------------------------------------------------------------
+template<auto Interval = 0u, typename T = reg>
+class SeqITimer
+{
+    static_assert(std::is_integral_v<T>, "SeqITimer requires integral T");
+    static_assert(std::is_unsigned_v<T>, "SeqITimer: T must be unsigned");
+
+public:
+    using value_type = T;
+    static constexpr bool is_static_interval  = (Interval != T{0});
+    static constexpr bool is_dynamic_interval = !is_static_interval;
+
+    static_assert(!is_static_interval
+                  || static_cast<unsigned long long>(Interval)
+                         <= static_cast<unsigned long long>(std::numeric_limits<T>::max()),
+                  "SeqITimer: Interval does not fit into T");
+
+    // One consistent view of the timer state
+    struct Snapshot {
+        value_type lastTime;
+        value_type interval;
+    };
+
+    // Static mode
+    template<auto I = Interval, std::enable_if_t<(I != T{0}), int> = 0>
+    constexpr SeqITimer() noexcept {}
+
+    // Dynamic mode: initial interval
+    template<auto I = Interval, std::enable_if_t<(I == T{0}), int> = 0>
+    explicit SeqITimer(const value_type iv = value_type{}) noexcept { publish(value_type{}, iv); }
+
+    _DELETE_COPY_MOVE(SeqITimer);
+
+    /*
+     * Readers (wait-free against a preempted writer)
+     */
+
+    [[nodiscard]] Snapshot snapshot() const noexcept {
+        for (;;) {
+            const u32 seq = _seq.load(std::memory_order_acquire);
+            const Slot& s = _slot[seq & 1u];
+            const Snapshot snap{s.lastTime.load(), intervalOf(s)};
+            seq_detail::fenceAcquire();
+            if (_seq.load(std::memory_order_relaxed) == seq) {
+                return snap;
+            }
+        }
+    }
+
+    [[nodiscard]] value_type getInterval() const noexcept {
+        if constexpr (is_static_interval) {
+            return static_cast<value_type>(Interval);
+        } else {
+            return snapshot().interval;
+        }
+    }
+
+    [[nodiscard]] bool isExpired(const value_type now) const noexcept {
+        const Snapshot s = snapshot();
+        return static_cast<value_type>(now - s.lastTime) >= s.interval;
+    }
+
+    [[nodiscard]] value_type timeLeft(const value_type now) const noexcept {
+        const Snapshot s = snapshot();
+        const value_type elapsed = static_cast<value_type>(now - s.lastTime);
+        return (elapsed >= s.interval) ? value_type{0} : static_cast<value_type>(s.interval - elapsed);
+    }
+
+    [[nodiscard]] value_type elapsed(const value_type now) const noexcept {
+        return static_cast<value_type>(now - snapshot().lastTime);
+    }
+
+    [[nodiscard]] static constexpr bool isAvailable() noexcept { return true; }
+
+    /*
+     * Writer (single context)
+     */
+
+    // Restart from now
+    void next(const value_type now) noexcept {
+        if constexpr (is_static_interval) {
+            publish(now, static_cast<value_type>(Interval));
+        } else {
+            publish(now, getIntervalWriter());
+        }
+    }
+
+    // Restart with a new interval (dynamic only)
+    void next(const value_type now, const value_type interval) noexcept {
+        if constexpr (is_static_interval) {
+            static_assert(!is_static_interval, "SeqITimer: cannot set interval on a static timer");
+        } else {
+            publish(now, interval);
+        }
+    }
+
+    SeqITimer& operator=(const value_type now) noexcept {
+        next(now);
+        return *this;
+    }
+
+private:
+    struct StaticSlot {
+        seq_detail::Words<value_type> lastTime;
+    };
+    struct DynamicSlot {
+        seq_detail::Words<value_type> lastTime;
+        seq_detail::Words<value_type> interval;
+    };
+    using Slot = std::conditional_t<is_static_interval, StaticSlot, DynamicSlot>;
+
+    static value_type intervalOf(const Slot& s) noexcept {
+        if constexpr (is_static_interval) {
+            (void)s;
+            return static_cast<value_type>(Interval);
+        } else {
+            return s.interval.load();
+        }
+    }
+
+    static void write(Slot& s, const value_type now, const value_type iv) noexcept {
+        s.lastTime.store(now);
+        if constexpr (is_dynamic_interval) {
+            s.interval.store(iv);
+        } else {
+            (void)iv;
+        }
+    }
+
+    // the writer owns both copies; copy 1 is never being rewritten between publishes
+    value_type getIntervalWriter() const noexcept { return intervalOf(_slot[1]); }
+
+    void publish(const value_type now, const value_type iv) noexcept {
+        const u32 seq = _seq.load(std::memory_order_relaxed);      // even, single writer
+
+        _seq.store(seq + 1u, std::memory_order_relaxed);            // readers -> copy 1
+        seq_detail::fenceRelease();
+        write(_slot[0], now, iv);
+
+        seq_detail::fenceRelease();
+        _seq.store(seq + 2u, std::memory_order_relaxed);            // readers -> copy 0
+        seq_detail::fenceRelease();
+        write(_slot[1], now, iv);
+    }
+
+private:
+    std::atomic<u32>    _seq{0};
+    std::array<Slot, 2> _slot{};
+};
+
+#endif /* STM32_TOOLS_TIME_INTERVAL_SEQITIMER_H_ */
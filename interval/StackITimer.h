@@ -17,19 +17,20 @@
 //   - StackITimer<>            => dynamic (interval set at runtime)
 //   - StackITimer<100>         => static 100 (compile-time)
 //   - Default interval type    => unsigned int (reg)
+//   - StackITimer<0u, T, P>    => custom runtime interval policy P
+//                                 (e.g. RtoIntervalPolicy), Interval must be 0
 //------------------------------------------------------------------------------
 
-template<auto Interval = 0u, typename T = reg>
-class StackITimer : public std::conditional_t<(Interval == T{0}),
-                                              DynamicIntervalPolicy<T>,
-                                              StaticIntervalPolicy<T, Interval>>
+template<auto Interval = 0u, typename T = reg,
+         class IntervalPolicy = default_interval_policy_t<Interval, T>>
+class StackITimer : public IntervalPolicy
 {
-    using Policy = std::conditional_t<(Interval == T{0}),
-                                      DynamicIntervalPolicy<T>,
-                                      StaticIntervalPolicy<T, Interval>>;
+    using Policy = IntervalPolicy;
 
     static_assert(std::is_integral_v<T>, "StackITimer requires integral T");
     static_assert(std::is_unsigned_v<T>, "StackITimer: T must be unsigned");
+    static_assert(Interval == T{0} || std::is_same_v<IntervalPolicy, StaticIntervalPolicy<T, Interval>>,
+                  "StackITimer: a custom interval policy needs Interval == 0");
 
     // Trait: does Policy provide a .setInterval(T) member?
     template<class P, class X, class = void>
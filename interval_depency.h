@@ -1,7 +1,26 @@
 #ifndef ITIME_DEPENCY_H
 #define ITIME_DEPENCY_H
 
+// Target builds get HAL/CMSIS from main.h. Host builds (Linux, simulations)
+// are explicit: -DTIME_HOST_BUILD (or -DTIME_SIM_BUILD, see Simulator.h),
+// no uwTick/DWT/TIM, host clocks and locks. A target build whose include
+// path lost main.h stops here instead of silently becoming a host build.
+#if defined(TIME_SIM_BUILD) && !defined(TIME_HOST_BUILD)
+#define TIME_HOST_BUILD 1
+#endif
+
+#ifndef TIME_HOST_BUILD
+#if __has_include("main.h")
 #include "main.h"
+#else
+#error "time: main.h not found. Add the HAL include path, or build for the host with -DTIME_HOST_BUILD"
+#endif
+#else
+#ifndef __IO
+#define __IO volatile
+#endif
+#endif
+
 #include "basic_types.h" // u32 definition
 #include "macro.h"
 #include <chrono>
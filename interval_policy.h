@@ -9,6 +9,7 @@
 #define STM32_TOOLS_TIME_INTERVAL_POLICY_H_
 
 #include "interval_depency.h"
+#include <limits>
 #include <type_traits>
 
 //------------------------------------------------------------------------------
@@ -51,4 +52,134 @@ private:
     }
 };
 
+//------------------------------------------------------------------------------
+// Default policy for a timer's Interval argument
+//------------------------------------------------------------------------------
+template<auto Interval, typename T>
+using default_interval_policy_t = std::conditional_t<(Interval == T{0}),
+                                                     DynamicIntervalPolicy<T>,
+                                                     StaticIntervalPolicy<T, Interval>>;
+
+//------------------------------------------------------------------------------
+// Adaptive retransmission timeout (RFC 6298, Jacobson/Karels)
+//  - onRttSample(r): SRTT += (r - SRTT)/8, RTTVAR += (|r - SRTT| - RTTVAR)/4,
+//    RTO = SRTT + max(Granularity, 4*RTTVAR), clamped to [MinRto, MaxRto]
+//    integer only: SRTT kept x8, RTTVAR kept x4
+//  - backoff(): doubles the interval after a timeout, capped at MaxRto;
+//    the next sample clears it. Do not sample retransmitted frames (Karn).
+//  - JitterShift != 0: each new interval is reduced by a deterministic
+//    pseudo-random [0, interval >> JitterShift], seeded with seedJitter()
+//    so that nodes sharing a medium do not retry in lockstep
+//  - getInterval() is a stored value, the timer's hot path is unchanged
+//  - setInterval() (the timer's next(interval)) overrides the RTO only,
+//    reset() starts the estimation over
+//
+//     using Rto = RtoIntervalPolicy<u32, 1000, 200, 30000, 3>;   // ms
+//     OneShotIBase<0u, Tick, Rto> retry;
+//------------------------------------------------------------------------------
+template<typename T, T InitialRto, T MinRto, T MaxRto, unsigned JitterShift = 0, T Granularity = 1>
+struct RtoIntervalPolicy {
+    static_assert(std::is_integral_v<T> && std::is_unsigned_v<T>, "RtoIntervalPolicy requires unsigned T");
+    static_assert(MinRto > T{0} && MinRto <= InitialRto && InitialRto <= MaxRto,
+                  "RtoIntervalPolicy requires 0 < MinRto <= InitialRto <= MaxRto");
+    static_assert(MaxRto <= (std::numeric_limits<T>::max() >> 3), "RtoIntervalPolicy: MaxRto too large for SRTT x8");
+    static_assert(JitterShift < std::numeric_limits<T>::digits, "RtoIntervalPolicy: JitterShift out of range");
+
+    constexpr RtoIntervalPolicy(const T initial = InitialRto) noexcept { reset(initial); }
+
+    // Restart estimation from `initial` (0 = InitialRto): no samples, no backoff
+    constexpr void reset(const T initial = InitialRto) noexcept {
+        _srtt8   = 0;
+        _rttvar4 = 0;
+        _rto     = clamp(initial ? initial : InitialRto);
+        _shift   = 0;
+        update();
+    }
+
+    // Override the current RTO (timer next(interval)/start(interval) path);
+    // SRTT/RTTVAR and the backoff are kept, the next sample replaces it
+    constexpr void setInterval(const T rto) noexcept {
+        _rto = clamp(rto ? rto : InitialRto);
+        update();
+    }
+
+    [[nodiscard]] constexpr T getInterval() const noexcept { return _interval; }
+
+    // Feed one measured round trip of a frame that was sent exactly once
+    constexpr void onRttSample(const T rtt) noexcept {
+        const T r = (rtt == T{0}) ? T{1} : ((rtt > MaxRto) ? MaxRto : rtt);   // 0 marks "no sample"
+        if (_srtt8 == 0u) {
+            _srtt8   = static_cast<T>(r << 3);
+            _rttvar4 = static_cast<T>(r << 1);      // RTTVAR = r/2
+        } else {
+            const T srtt = static_cast<T>(_srtt8 >> 3);
+            T err = 0;
+            if (r >= srtt) {
+                err = static_cast<T>(r - srtt);
+                _srtt8 = static_cast<T>(_srtt8 + err);
+            } else {
+                err = static_cast<T>(srtt - r);
+                _srtt8 = static_cast<T>(_srtt8 - err);
+            }
+            const T var = static_cast<T>(_rttvar4 >> 2);
+            _rttvar4 = (err >= var) ? static_cast<T>(_rttvar4 + (err - var))
+                                    : static_cast<T>(_rttvar4 - (var - err));
+        }
+        const T spread = (_rttvar4 > Granularity) ? _rttvar4 : Granularity;
+        _rto   = clamp(static_cast<T>((_srtt8 >> 3) + spread));
+        _shift = 0;
+        update();
+    }
+
+    // Timeout happened: double the interval (up to MaxRto)
+    constexpr void backoff() noexcept {
+        if ((_rto << _shift) < MaxRto) {
+            ++_shift;
+        }
+        update();
+    }
+
+    // Keep the estimate, drop the backoff
+    constexpr void resetBackoff() noexcept {
+        _shift = 0;
+        update();
+    }
+
+    constexpr void seedJitter(const u32 seed) noexcept { _seed = seed ? seed : 1u; }
+
+    [[nodiscard]] constexpr T   srtt()    const noexcept { return static_cast<T>(_srtt8 >> 3); }
+    [[nodiscard]] constexpr T   rttvar()  const noexcept { return static_cast<T>(_rttvar4 >> 2); }
+    [[nodiscard]] constexpr T   rto()     const noexcept { return _rto; }
+    [[nodiscard]] constexpr u8  backoffs() const noexcept { return _shift; }
+
+private:
+    static constexpr T clamp(const T v) noexcept {
+        return (v < MinRto) ? MinRto : ((v > MaxRto) ? MaxRto : v);
+    }
+
+    constexpr void update() noexcept {
+        // backoff() stops once rto << shift reaches MaxRto, so the shifted
+        // value stays below 2 * MaxRto and cannot overflow T
+        const T raw = static_cast<T>(_rto << _shift);
+        T iv = (raw > MaxRto) ? MaxRto : raw;
+
+        if constexpr (JitterShift != 0) {
+            _seed ^= _seed << 13;               // xorshift32
+            _seed ^= _seed >> 17;
+            _seed ^= _seed << 5;
+            const T span = static_cast<T>(iv >> JitterShift);
+            iv = static_cast<T>(iv - static_cast<T>(_seed % (static_cast<u32>(span) + 1u)));
+        }
+        _interval = iv;
+    }
+
+private:
+    T   _interval = InitialRto;   ///< what the timer uses: rto << backoff, capped, jittered
+    T   _rto      = InitialRto;   ///< estimate without backoff
+    T   _srtt8    = 0;            ///< SRTT x8, 0 = no sample yet
+    T   _rttvar4  = 0;            ///< RTTVAR x4
+    u32 _seed     = 0x2545F491u;
+    u8  _shift    = 0;
+};
+
 #endif /* STM32_TOOLS_TIME_INTERVAL_POLICY_H_ */
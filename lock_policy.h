@@ -0,0 +1,291 @@
+/*
+ * lock_policy.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ */
+
+#ifndef STM32_TOOLS_TIME_LOCK_POLICY_H_
+#define STM32_TOOLS_TIME_LOCK_POLICY_H_
+
+#include "interval_depency.h"
+#include <type_traits>
+
+//------------------------------------------------------------------------------
+// Critical-section policies for the virtual timer registries.
+//
+// Every policy is an RAII guard: the constructor enters the critical section,
+// the destructor leaves it. Select one for the whole build with
+//
+//     -DTIME_LOCK_POLICY=NoLock          (or any guard type below)
+//
+// Default: IrqLock on target, StdMutexLock on host builds.
+//
+// lock_traits<L>::tick_needs_lock tells the registries whether the tick
+// (proceed()) must take the lock too. Interrupt-based locks don't: the tick
+// runs in the ISR they mask. Thread-based locks do: the tick is a thread.
+//------------------------------------------------------------------------------
+
+template<class Lock>
+struct lock_traits {
+    static constexpr bool tick_needs_lock = false;
+};
+
+//------------------------------------------------------------------------------
+// NoLock: single-context builds (tick and main never preempt each other)
+//------------------------------------------------------------------------------
+class NoLock {
+public:
+    NoLock() noexcept {}
+    ~NoLock() noexcept {} // user-provided: "unused guard" warnings stay quiet
+    _DELETE_COPY_MOVE(NoLock);
+};
+
+#ifndef TIME_HOST_BUILD
+
+#include "irq/IRQGuard.h"
+
+//------------------------------------------------------------------------------
+// IrqLock: global interrupt masking (PRIMASK), the historical behavior
+//------------------------------------------------------------------------------
+using IrqLock = IRQGuard;
+
+//------------------------------------------------------------------------------
+// BasepriLock<Priority>: masks only interrupts with priority >= Priority
+// (numerically), higher-priority ISRs keep running. The tick ISR must have a
+// priority inside the masked range. Cortex-M3 and above only.
+//------------------------------------------------------------------------------
+#if defined(__CORTEX_M) && (__CORTEX_M >= 3U)
+template<u32 Priority>
+class BasepriLock {
+    static_assert(Priority > 0U, "BasepriLock: priority 0 would disable masking (BASEPRI = 0)");
+    static_assert(Priority < (1U << __NVIC_PRIO_BITS), "BasepriLock: priority out of range");
+
+public:
+    BasepriLock() noexcept : _prev(__get_BASEPRI()) {
+        // _MAX variant never lowers an already raised threshold (nesting-safe)
+        __set_BASEPRI_MAX(Priority << (8U - __NVIC_PRIO_BITS));
+        __DSB();
+        __ISB();
+    }
+    ~BasepriLock() noexcept { __set_BASEPRI(_prev); }
+
+    _DELETE_COPY_MOVE(BasepriLock);
+
+private:
+    const u32 _prev;
+};
+#endif /* __CORTEX_M >= 3 */
+
+//------------------------------------------------------------------------------
+// RtosMutexLock: CMSIS-RTOS2 mutex. Only valid when the tick is driven from a
+// thread (not an ISR), e.g. an RTOS timer task calling HAL_SYSTICK_Callback().
+//------------------------------------------------------------------------------
+#if __has_include("cmsis_os2.h")
+#include "cmsis_os2.h"
+
+class RtosMutexLock {
+public:
+    RtosMutexLock() noexcept { osMutexAcquire(mutex(), osWaitForever); }
+    ~RtosMutexLock() noexcept { osMutexRelease(mutex()); }
+
+    _DELETE_COPY_MOVE(RtosMutexLock);
+
+private:
+    static osMutexId_t mutex() noexcept {
+        static const osMutexId_t _mutex = osMutexNew(nullptr);
+        return _mutex;
+    }
+};
+
+template<>
+struct lock_traits<RtosMutexLock> {
+    static constexpr bool tick_needs_lock = true;
+};
+#endif /* cmsis_os2.h */
+
+#endif /* !TIME_HOST_BUILD */
+
+//------------------------------------------------------------------------------
+// Host locks (need the C++ threading library). On target toolchains that
+// provide std::mutex (hosted RTOS ports) enable them with -DTIME_LOCK_STD.
+//------------------------------------------------------------------------------
+#if defined(TIME_HOST_BUILD) || defined(TIME_LOCK_STD)
+#include <atomic>
+#include <mutex>
+
+class StdMutexLock {
+public:
+    StdMutexLock() noexcept { _mutex.lock(); }
+    ~StdMutexLock() noexcept { _mutex.unlock(); }
+
+    _DELETE_COPY_MOVE(StdMutexLock);
+
+private:
+    static inline std::mutex _mutex;
+};
+
+class SpinLock {
+public:
+    SpinLock() noexcept {
+        while (_flag.test_and_set(std::memory_order_acquire)) {
+            // spin: critical sections in the registries are a few instructions long
+        }
+    }
+    ~SpinLock() noexcept { _flag.clear(std::memory_order_release); }
+
+    _DELETE_COPY_MOVE(SpinLock);
+
+private:
+    static inline std::atomic_flag _flag = ATOMIC_FLAG_INIT;
+};
+
+template<>
+struct lock_traits<StdMutexLock> {
+    static constexpr bool tick_needs_lock = true;
+};
+
+template<>
+struct lock_traits<SpinLock> {
+    static constexpr bool tick_needs_lock = true;
+};
+#endif /* TIME_HOST_BUILD || TIME_LOCK_STD */
+
+//------------------------------------------------------------------------------
+// Build-wide selection
+//------------------------------------------------------------------------------
+// -DTIME_SIM_BUILD: one simulated board per thread (Simulator.h). The timer
+// registries are thread_local and a board's "ISRs" run on its own thread,
+// so nothing is shared and the default lock is NoLock.
+#ifdef TIME_SIM_BUILD
+#define TIME_BOARD_LOCAL thread_local
+
+// Bumped by every SimBoard. Board-local counters that are not owned by a
+// SimBoard (domain tick counts, prescaler phases) restart from zero the
+// first time they see a new value, so a board never inherits them from the
+// previous board of its thread.
+inline thread_local u32 time_board_epoch = 0;
+#else
+#define TIME_BOARD_LOCAL
+#endif
+
+#ifndef TIME_LOCK_POLICY
+#   if defined(TIME_SIM_BUILD)
+#       define TIME_LOCK_POLICY NoLock
+#   elif defined(TIME_HOST_BUILD)
+#       define TIME_LOCK_POLICY StdMutexLock
+#   else
+#       define TIME_LOCK_POLICY IrqLock
+#   endif
+#endif
+
+// -DTIME_CPU_MONITOR_LOCKS=1: every TimeLock section is timed (CpuMonitor.h)
+template<class Lock> class MonitoredLock;
+
+template<class Lock>
+struct lock_traits<MonitoredLock<Lock>> : lock_traits<Lock> {};
+
+#if defined(TIME_CPU_MONITOR_LOCKS) && TIME_CPU_MONITOR_LOCKS
+using TimeLock = MonitoredLock<TIME_LOCK_POLICY>;
+#else
+using TimeLock = TIME_LOCK_POLICY;
+#endif
+
+//------------------------------------------------------------------------------
+// AtomicWord<T>: one counter word shared between the tick and other contexts,
+// updated without a critical section.
+//   - host (and -DTIME_LOCK_STD): std::atomic<T>
+//   - Cortex-M3 and above: LDREX/STREX. Exception entry clears the exclusive
+//     monitor, so a compare-and-swap preempted by the tick retries instead of
+//     overwriting it.
+//   - Cortex-M0/M0+ (no exclusive access): the compare-and-swap masks
+//     interrupts (IrqLock) for its three instructions; load/store stay plain
+//
+// cas() is strong: it fails only when the word differs from `expected`,
+// which is then updated to the current value.
+//------------------------------------------------------------------------------
+#if defined(TIME_HOST_BUILD) || defined(TIME_LOCK_STD)
+
+template<typename T>
+class AtomicWord {
+public:
+    constexpr AtomicWord(const T v = T{}) noexcept : _v(v) {}
+    _DELETE_COPY_MOVE(AtomicWord);
+
+    T load() const noexcept { return _v.load(std::memory_order_acquire); }
+    void store(const T v) noexcept { _v.store(v, std::memory_order_release); }
+    bool cas(T& expected, const T desired) noexcept {
+        return _v.compare_exchange_strong(expected, desired, std::memory_order_acq_rel, std::memory_order_acquire);
+    }
+
+private:
+    std::atomic<T> _v;
+};
+
+#else /* target */
+
+template<typename T>
+class AtomicWord {
+    static_assert(sizeof(T) == sizeof(u32), "AtomicWord: one 32-bit word on target");
+
+public:
+    constexpr AtomicWord(const T v = T{}) noexcept : _v(v) {}
+    _DELETE_COPY_MOVE(AtomicWord);
+
+    T load() const noexcept { return _v; }
+    void store(const T v) noexcept { _v = v; }
+    bool cas(T& expected, const T desired) noexcept {
+#if defined(__CORTEX_M) && (__CORTEX_M >= 3U)
+        do {
+            const T cur = static_cast<T>(__LDREXW(reinterpret_cast<volatile u32*>(&_v)));
+            if (cur != expected) {
+                __CLREX();
+                expected = cur;
+                return false;
+            }
+        } while (__STREXW(static_cast<u32>(desired), reinterpret_cast<volatile u32*>(&_v)) != 0U);
+        return true;
+#else
+        IrqLock guard;
+        const T cur = _v;
+        if (cur != expected) {
+            expected = cur;
+            return false;
+        }
+        _v = desired;
+        return true;
+#endif
+    }
+
+private:
+    volatile T _v;
+};
+
+#endif /* TIME_HOST_BUILD || TIME_LOCK_STD */
+
+//------------------------------------------------------------------------------
+// Runs fn() inside the tick, taking TimeLock only if the policy requires it.
+// A MonitoredLock TimeLock records the caller's file/line, not this one.
+//------------------------------------------------------------------------------
+template<class Fn>
+inline void time_tick_locked(Fn&& fn, const char* const file = __builtin_FILE(),
+                             const u32 line = __builtin_LINE()) {
+    (void)file;
+    (void)line;
+    if constexpr (lock_traits<TimeLock>::tick_needs_lock) {
+#if defined(TIME_CPU_MONITOR_LOCKS) && TIME_CPU_MONITOR_LOCKS
+        TimeLock guard(file, line);
+#else
+        TimeLock guard;
+#endif
+        fn();
+    } else {
+        fn();
+    }
+}
+
+#if defined(TIME_CPU_MONITOR_LOCKS) && TIME_CPU_MONITOR_LOCKS
+#include "CpuMonitor.h"   // MonitoredLock definition, after TimeLock is declared
+#endif
+
+#endif /* STM32_TOOLS_TIME_LOCK_POLICY_H_ */
@@ -0,0 +1,360 @@
+/*
+ * EdfDispatcher.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Earliest-deadline-first callback dispatcher over an intrusive binary heap
+ */
+
+#ifndef STM32_TOOLS_TIME_SCHEDULER_EDFDISPATCHER_H_
+#define STM32_TOOLS_TIME_SCHEDULER_EDFDISPATCHER_H_
+
+#include "time/interval_depency.h"
+#include "Slack.h"
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <type_traits>
+
+template<class Policy, u16 Capacity> class EdfDispatcher;
+
+//------------------------------------------------------------------------------
+// EdfTask<Policy>:
+//   - one entry of an EdfDispatcher: absolute deadline + callback
+//   - period == 0 -> one-shot, otherwise re-queued at deadline + period
+//   - slack != 0  -> may run anywhere in [deadline, deadline + slack]: it forces a
+//                    wakeup only at deadline + slack, and runs earlier whenever
+//                    another task wakes the dispatcher inside its window
+//   - knows its own heap slot, so cancel/re-arm are O(log N)
+//   - a queued task must be cancelled before it is destroyed; a task due in a
+//     running poll() must outlive that poll()
+//------------------------------------------------------------------------------
+template<class Policy>
+class EdfTask
+{
+    template<class, u16> friend class EdfDispatcher;
+
+public:
+    using value_type = typename Policy::type_t;
+    using Callback   = void (*)(EdfTask&);
+
+    static_assert(std::is_unsigned_v<value_type>, "EdfTask: Policy::type_t must be unsigned");
+
+    constexpr explicit EdfTask(const Callback cb = nullptr) noexcept : _callback(cb) {}
+
+    _DELETE_COPY_MOVE(EdfTask);
+
+    [[nodiscard]] constexpr bool       isQueued() const noexcept { return _slot != npos; }
+    [[nodiscard]] constexpr value_type deadline() const noexcept { return _deadline; }
+    [[nodiscard]] constexpr value_type period()   const noexcept { return _period; }
+    [[nodiscard]] constexpr value_type slack()    const noexcept { return _slack; }
+
+    // Latest instant the task runs at (deadline + slack)
+    [[nodiscard]] constexpr value_type fireAt()   const noexcept { return _fire; }
+
+    void setCallback(const Callback cb) noexcept { _callback = cb; }
+
+private:
+    static constexpr u16 npos    = std::numeric_limits<u16>::max();
+    static constexpr u16 pending = npos - 1u;   ///< due in the running poll(), callback not run yet
+
+    value_type _deadline = 0;      ///< nominal deadline (periodic phase reference)
+    value_type _fire     = 0;      ///< heap key: _deadline + _slack
+    value_type _period   = 0;
+    value_type _slack    = 0;
+    Callback   _callback = nullptr;
+    u16        _slot     = npos;   ///< index in the heap, pending, or npos when not queued
+};
+
+//------------------------------------------------------------------------------
+// EdfDispatcher<Policy, Capacity>:
+//   - binary min-heap of EdfTask* keyed by latest fire instant (deadline + slack)
+//   - deadlines compared with unsigned wrap-around: all queued deadlines must
+//     lie within half the range of Policy::type_t from each other
+//   - start/startPeriodic/cancel: O(log N); poll(): one Policy::now() read,
+//     O(log N) per due task, plus one O(N) partition + heapify per wakeup
+//     while tasks with slack are queued (coalescing); nextDue(): O(1)
+//   - poll() first takes every task due at its instant out of the heap, then
+//     runs them in fire order: a task (re-)armed by a callback runs in a later
+//     poll() at the earliest, even with period or interval 0. Due tasks hold
+//     their storage slot until their callback has run.
+//   - fixed storage, no allocation; main-context only (not ISR-safe)
+//------------------------------------------------------------------------------
+template<class Policy, u16 Capacity>
+class EdfDispatcher
+{
+public:
+    using Task       = EdfTask<Policy>;
+    using value_type = typename Task::value_type;
+
+    static_assert(Capacity > 0 && Capacity < Task::pending, "EdfDispatcher: Capacity out of range");
+
+    static constexpr value_type never = std::numeric_limits<value_type>::max();
+
+    constexpr EdfDispatcher() noexcept = default;
+    _DELETE_COPY_MOVE(EdfDispatcher);
+
+    ~EdfDispatcher() { clear(); }
+
+    // One-shot: run cb once, `interval` ticks from now (+ up to `slack`). Re-arms if already queued.
+    bool start(Task& t, const value_type interval, const value_type slack = 0) noexcept {
+        t._period = 0;
+        setSlack(t, slack);
+        return schedule(t, static_cast<value_type>(Policy::now() + interval));
+    }
+
+    // Periodic: first run `period` ticks from now, then every `period` ticks (phase-locked,
+    // the slack never accumulates)
+    bool startPeriodic(Task& t, const value_type period, const value_type slack = 0) noexcept {
+        t._period = period;
+        setSlack(t, slack);
+        return schedule(t, static_cast<value_type>(Policy::now() + period));
+    }
+
+    // Absolute deadline, keeps the task's period and slack
+    bool startAt(Task& t, const value_type deadline) noexcept {
+        return schedule(t, deadline);
+    }
+
+    // Also keeps a task that is due in the running poll() from running
+    void cancel(Task& t) noexcept {
+        if (t._slot < Capacity) {
+            removeAt(t._slot);
+        } else {
+            t._slot = Task::npos;
+        }
+    }
+
+    void clear() noexcept {
+        for (u16 i = 0; i < _size; ++i) {
+            _heap[i]->_slot = Task::npos;
+        }
+        for (u32 i = _runAt; i < Capacity; ++i) {
+            _heap[i]->_slot = Task::npos;
+        }
+        _size    = 0;
+        _slacked = 0;
+    }
+
+    /**
+     * @brief Runs every task due at this instant. Reads Policy::now() once.
+     * @return number of callbacks invoked.
+     */
+    reg poll() noexcept(noexcept(Policy::now())) {
+        const value_type now = Policy::now();
+        const u16 size0 = _size;
+
+        // due tasks leave the heap into the freed tail slots: [_size, size0),
+        // latest fire first
+        while (_size != 0u && isDue(_heap[0]->_fire, now)) {
+            Task* const t = _heap[0];
+            removeAt(0);
+            _heap[_size] = t;
+            t->_slot     = Task::pending;
+        }
+        if (_size == size0) {
+            return 0;
+        }
+
+        // coalescing: this pass is a wakeup anyway, also take every task whose
+        // slack window is already open instead of waking again for it later.
+        // One partition of the heap array, one O(N) heapify of the rest.
+        Task** const heap = _heap.data();
+        Task** const due  = heap + _size;
+        Task** first      = due;
+        if (_slacked != 0u) {
+            first = std::partition(heap, due, [now](const Task* const t) { return !isDue(t->_deadline, now); });
+            for (Task** p = first; p != due; ++p) {
+                (*p)->_slot = Task::pending;
+            }
+            _slacked = static_cast<u16>(_slacked - (due - first));
+            _size    = static_cast<u16>(first - heap);
+            rebuild();
+            std::sort(first, due, [](const Task* const a, const Task* const b) { return isBefore(a->_fire, b->_fire); });
+        }
+
+        // run order: due tasks by fire instant, then the coalesced ones; moved
+        // to the top of the array so callbacks can push below them
+        std::reverse(due, heap + size0);
+        std::rotate(first, due, heap + size0);
+        const u16 count = static_cast<u16>((heap + size0) - first);
+        std::move_backward(first, heap + size0, heap + Capacity);
+
+        reg fired = 0;
+        for (_runAt = static_cast<u16>(Capacity - count); _runAt < Capacity; ) {
+            Task& t = *_heap[_runAt++];
+            if (t._slot != Task::pending) {
+                continue;                 // cancelled or re-armed by an earlier callback
+            }
+            t._slot = Task::npos;
+            run(t, now);
+            ++fired;
+        }
+
+        ++_stats.wakeups;
+        _stats.fired += fired;
+        return fired;
+    }
+
+    /**
+     * @brief Ticks until the earliest deadline: 0 if due, `never` if empty.
+     *
+     * The loop can sleep that long (e.g. WFI with a wake-up timer).
+     */
+    [[nodiscard]] value_type nextDue() const noexcept(noexcept(Policy::now())) {
+        if (_size == 0u) {
+            return never;
+        }
+        const value_type now = Policy::now();
+        const value_type d   = _heap[0]->_fire;
+        return isDue(d, now) ? value_type{0} : static_cast<value_type>(d - now);
+    }
+
+    [[nodiscard]] const Task* top() const noexcept { return _size ? _heap[0] : nullptr; }
+    [[nodiscard]] constexpr u16  size()  const noexcept { return _size; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return _size == 0u; }
+    [[nodiscard]] static constexpr u16 capacity() noexcept { return Capacity; }
+
+    // Wakeups vs. fired tasks since the last resetStats()
+    [[nodiscard]] constexpr const SlackStats& stats() const noexcept { return _stats; }
+    constexpr void resetStats() noexcept { _stats = SlackStats{}; }
+
+private:
+    static constexpr value_type half = static_cast<value_type>(never / 2u + 1u);
+
+    // deadline <= now, modulo the type range
+    static constexpr bool isDue(const value_type deadline, const value_type now) noexcept {
+        return static_cast<value_type>(now - deadline) < half;
+    }
+
+    // a strictly before b, modulo the type range
+    static constexpr bool isBefore(const value_type a, const value_type b) noexcept {
+        return static_cast<value_type>(a - b) >= half;
+    }
+
+    void setSlack(Task& t, const value_type slack) noexcept {
+        if (t._slot < Capacity) {
+            _slacked = static_cast<u16>(_slacked - (t._slack != 0u) + (slack != 0u));
+        }
+        t._slack = slack;
+    }
+
+    // Re-queue a periodic task, then invoke its callback
+    void run(Task& t, const value_type now) {
+        if (t._period != 0u) {
+            // phase-locked: next slot after `now`, missed periods are skipped
+            value_type next = static_cast<value_type>(t._deadline + t._period);
+            if (isDue(next, now)) {
+                const value_type late = static_cast<value_type>(now - t._deadline);
+                next = static_cast<value_type>(t._deadline + (late / t._period + 1u) * t._period);
+            }
+            t._deadline = next;
+            t._fire     = static_cast<value_type>(next + t._slack);
+            push(t);
+        }
+
+        if (t._callback) {
+            t._callback(t);   // may cancel/re-arm itself or others
+        }
+    }
+
+    bool schedule(Task& t, const value_type deadline) noexcept {
+        const value_type fire = static_cast<value_type>(deadline + t._slack);
+        t._deadline = deadline;
+
+        if (t._slot < Capacity) {
+            const bool earlier = isBefore(fire, t._fire);
+            t._fire = fire;
+            earlier ? siftUp(t._slot) : siftDown(t._slot);
+            return true;
+        }
+        t._fire = fire;
+        t._slot = Task::npos;     // re-armed while due in this poll(): not run in it
+        return push(t);
+    }
+
+    bool push(Task& t) noexcept {
+        if (_size == _runAt) {
+            return false;         // full, or the rest is held by due tasks of the running poll()
+        }
+        place(_size, &t);
+        siftUp(_size++);
+        _slacked = static_cast<u16>(_slacked + (t._slack != 0u));
+        return true;
+    }
+
+    void removeAt(const u16 i) noexcept {
+        _slacked = static_cast<u16>(_slacked - (_heap[i]->_slack != 0u));
+        _heap[i]->_slot = Task::npos;
+        --_size;
+        if (i == _size) {
+            return;
+        }
+        place(i, _heap[_size]);
+        if (i > 0u && isBefore(_heap[i]->_fire, _heap[parent(i)]->_fire)) {
+            siftUp(i);
+        } else {
+            siftDown(i);
+        }
+    }
+
+    void siftUp(u16 i) noexcept {
+        Task* const t = _heap[i];
+        while (i > 0u) {
+            const u16 p = parent(i);
+            if (!isBefore(t->_fire, _heap[p]->_fire)) {
+                break;
+            }
+            place(i, _heap[p]);
+            i = p;
+        }
+        place(i, t);
+    }
+
+    void siftDown(u16 i) noexcept {
+        Task* const t = _heap[i];
+        for (;;) {
+            const u32 l = 2u * i + 1u;
+            if (l >= _size) {
+                break;
+            }
+            u16 c = static_cast<u16>(l);
+            if (l + 1u < _size && isBefore(_heap[l + 1u]->_fire, _heap[l]->_fire)) {
+                c = static_cast<u16>(l + 1u);
+            }
+            if (!isBefore(_heap[c]->_fire, t->_fire)) {
+                break;
+            }
+            place(i, _heap[c]);
+            i = c;
+        }
+        place(i, t);
+    }
+
+    // Floyd heap construction over [0, _size)
+    void rebuild() noexcept {
+        for (u16 i = 0; i < _size; ++i) {
+            _heap[i]->_slot = i;
+        }
+        for (u16 i = static_cast<u16>(_size / 2u); i-- > 0u; ) {
+            siftDown(i);
+        }
+    }
+
+    static constexpr u16 parent(const u16 i) noexcept { return static_cast<u16>((i - 1u) / 2u); }
+
+    void place(const u16 i, Task* const t) noexcept {
+        _heap[i] = t;
+        t->_slot = i;
+    }
+
+private:
+    std::array<Task*, Capacity> _heap{};
+    u16 _size    = 0;
+    u16 _slacked = 0;   ///< queued tasks with slack != 0
+    u16 _runAt   = Capacity;   ///< next due task of the running poll(), Capacity outside poll()
+    SlackStats _stats{};
+};
+
+#endif /* STM32_TOOLS_TIME_SCHEDULER_EDFDISPATCHER_H_ */
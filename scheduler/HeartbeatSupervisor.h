@@ -0,0 +1,197 @@
+/*
+ * HeartbeatSupervisor.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Per-task heartbeat deadlines with an O(1) periodic check, for feeding a watchdog
+ */
+
+#ifndef STM32_TOOLS_TIME_SCHEDULER_HEARTBEATSUPERVISOR_H_
+#define STM32_TOOLS_TIME_SCHEDULER_HEARTBEATSUPERVISOR_H_
+
+#include "time/interval_depency.h"
+#include <array>
+#include <limits>
+#include <type_traits>
+
+//------------------------------------------------------------------------------
+// HeartbeatSupervisor<Policy, N>:
+//   - one deadline per task in a flat array; beat(i) is one store:
+//     deadline[i] = Policy::now() + timeout[i]
+//   - check() keeps a lower bound of the earliest deadline. Deadlines only
+//     move forward on beat(), so a bound read earlier stays valid: while it
+//     lies in the future, no task can be late and the check is O(1)
+//   - every check() also re-reads one slot (round robin); after N checks the
+//     bound is the minimum of one full sweep, which keeps it close to the
+//     real earliest deadline
+//   - only when the bound has passed, one O(N) scan decides: either a task is
+//     overdue (reported with its lateness), or the bound is moved up
+//   - deadlines compare with unsigned wrap-around: timeouts must be shorter
+//     than half the range of Policy::type_t
+//
+//     HeartbeatSupervisor<Tick, 32> sup;
+//     sup.enable(CommTask, 100);              // must beat at least every 100 ms
+//     ... in the task: sup.beat(CommTask);
+//     ... every IWDG window: if (sup.check()) HAL_IWDG_Refresh(&hiwdg);
+//                            else log(sup.starved().task, sup.starved().overdue);
+//
+// beat() may run in any context (ISR included) when Policy::type_t is at most
+// one machine word; enable()/disable()/check() belong to the supervisor context.
+//------------------------------------------------------------------------------
+template<class Policy, u16 N>
+class HeartbeatSupervisor
+{
+public:
+    using value_type = typename Policy::type_t;
+
+    static_assert(std::is_unsigned_v<value_type>, "HeartbeatSupervisor: Policy::type_t must be unsigned");
+    static_assert(N > 0 && N < std::numeric_limits<u16>::max(), "HeartbeatSupervisor: N out of range");
+
+    static constexpr u16 none = std::numeric_limits<u16>::max();
+
+    // Outcome of the last failed check()
+    struct Starved {
+        u16        task    = none;
+        value_type overdue = 0;   ///< ticks past its deadline when detected
+    };
+
+    // Cost counters: full scans per check() should stay near 0
+    struct Stats {
+        u32 checks = 0;
+        u32 scans  = 0;
+    };
+
+    constexpr HeartbeatSupervisor() noexcept = default;
+    _DELETE_COPY_MOVE(HeartbeatSupervisor);
+
+    // Supervise `task`: first deadline `timeout` ticks from now
+    void enable(const u16 task, const value_type timeout) noexcept {
+        if (task >= N || timeout == 0u || timeout >= half) {
+            return;
+        }
+        const value_type d = static_cast<value_type>(Policy::now() + timeout);
+        const bool first = (_active == 0u);
+        if (_timeout[task] == 0u) {
+            ++_active;
+        }
+        _timeout[task]  = timeout;
+        _deadline[task] = d;
+
+        // a new deadline may be earlier than the bound, also for the running sweep
+        if (first || isBefore(d, _bound)) {
+            _bound = d;
+        }
+        if (!_sweepHas || isBefore(d, _sweepMin)) {
+            _sweepMin = d;
+            _sweepHas = true;
+        }
+    }
+
+    void disable(const u16 task) noexcept {
+        if (task < N && _timeout[task] != 0u) {
+            _timeout[task] = 0;
+            --_active;
+        }
+    }
+
+    // Task check-in: one store
+    void beat(const u16 task) noexcept {
+        _deadline[task] = static_cast<value_type>(Policy::now() + _timeout[task]);
+    }
+
+    /**
+     * @brief Periodic supervision. One Policy::now() read.
+     * @return true if no task is overdue (kick the watchdog), false otherwise;
+     *         starved() tells which task and by how much.
+     */
+    bool check() noexcept(noexcept(Policy::now())) {
+        const value_type now = Policy::now();
+        ++_stats.checks;
+        sweepOne();
+
+        if (_active == 0u || isBefore(now, _bound)) {
+            return true;
+        }
+        return scan(now);
+    }
+
+    [[nodiscard]] constexpr const Starved& starved() const noexcept { return _starved; }
+
+    // Earliest deadline bound (no task can be late before it)
+    [[nodiscard]] constexpr value_type bound() const noexcept { return _bound; }
+
+    [[nodiscard]] constexpr value_type deadline(const u16 task) const noexcept { return _deadline[task]; }
+    [[nodiscard]] constexpr bool isEnabled(const u16 task) const noexcept { return _timeout[task] != 0u; }
+    [[nodiscard]] constexpr u16 active() const noexcept { return _active; }
+    [[nodiscard]] static constexpr u16 capacity() noexcept { return N; }
+
+    [[nodiscard]] constexpr const Stats& stats() const noexcept { return _stats; }
+    void resetStats() noexcept { _stats = Stats{}; }
+
+private:
+    static constexpr value_type half =
+        static_cast<value_type>(std::numeric_limits<value_type>::max() / 2u + 1u);
+
+    // a strictly before b, modulo the type range
+    static constexpr bool isBefore(const value_type a, const value_type b) noexcept {
+        return static_cast<value_type>(a - b) >= half;
+    }
+
+    // Round-robin refresh: one slot per check, bound = minimum of the last full sweep
+    void sweepOne() noexcept {
+        const u16 k = _cursor;
+        if (_timeout[k] != 0u) {
+            const value_type d = _deadline[k];
+            if (!_sweepHas || isBefore(d, _sweepMin)) {
+                _sweepMin = d;
+                _sweepHas = true;
+            }
+        }
+        if (++_cursor == N) {
+            _cursor = 0;
+            if (_sweepHas && isBefore(_bound, _sweepMin)) {
+                _bound = _sweepMin;
+            }
+            _sweepHas = false;
+        }
+    }
+
+    // Exact earliest deadline; reports the most overdue task if it has passed
+    bool scan(const value_type now) noexcept {
+        ++_stats.scans;
+        u16        first = none;
+        value_type min   = 0;
+        for (u16 i = 0; i < N; ++i) {
+            if (_timeout[i] == 0u) {
+                continue;
+            }
+            const value_type d = _deadline[i];
+            if (first == none || isBefore(d, min)) {
+                first = i;
+                min   = d;
+            }
+        }
+
+        _bound = min;
+        if (first == none || isBefore(now, min)) {
+            return true;
+        }
+        _starved.task    = first;
+        _starved.overdue = static_cast<value_type>(now - min);
+        return false;
+    }
+
+private:
+    std::array<volatile value_type, N> _deadline{};   ///< written by beat()
+    std::array<value_type, N>          _timeout{};    ///< 0 = not supervised
+    value_type _bound    = 0;                ///< no deadline before this instant
+    value_type _sweepMin = 0;
+    u16        _cursor   = 0;
+    u16        _active   = 0;
+    bool       _sweepHas = false;
+    Starved    _starved{};
+    Stats      _stats{};
+};
+
+#endif /* STM32_TOOLS_TIME_SCHEDULER_HEARTBEATSUPERVISOR_H_ */
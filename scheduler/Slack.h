@@ -0,0 +1,61 @@
+/*
+ * Slack.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ */
+
+#ifndef STM32_TOOLS_TIME_SCHEDULER_SLACK_H_
+#define STM32_TOOLS_TIME_SCHEDULER_SLACK_H_
+
+#include "time/interval_depency.h"
+#include <limits>
+#include <type_traits>
+
+//------------------------------------------------------------------------------
+// Slack: timer coalescing by alignment.
+//
+// A timer with slack may fire anywhere in [deadline, deadline + slack].
+// align() picks the instant in that window with the most trailing zero bits,
+// i.e. the coarsest power-of-two boundary. Timers whose windows overlap
+// tend to land on the same boundary and fire in the same wakeup, without
+// the timers knowing about each other. O(1), no state.
+//------------------------------------------------------------------------------
+class Slack
+{
+    STATIC_CLASS(Slack);
+public:
+    template<typename T>
+    [[nodiscard]] static constexpr T align(const T deadline, const T slack) noexcept {
+        static_assert(std::is_unsigned_v<T>, "Slack::align: T must be unsigned");
+
+        if (slack == T{0}) {
+            return deadline;
+        }
+
+        // windows are bounded by half the range like every wrap-safe comparison
+        constexpr T max_slack = static_cast<T>(std::numeric_limits<T>::max() / 2u);
+        const T hi = static_cast<T>(deadline + ((slack > max_slack) ? max_slack : slack));
+
+        // highest bit where (deadline - 1) and hi differ: the boundary at that
+        // bit is the most aligned instant in (deadline - 1, hi], wrap included
+        T mask = static_cast<T>(static_cast<T>(deadline - T{1}) ^ hi);
+        for (unsigned s = 1; s < std::numeric_limits<T>::digits; s <<= 1) {
+            mask = static_cast<T>(mask | (mask >> s));
+        }
+        return static_cast<T>(hi & ~(mask >> 1));
+    }
+};
+
+//------------------------------------------------------------------------------
+// Wakeup accounting for coalescing schedulers
+//------------------------------------------------------------------------------
+struct SlackStats {
+    u32 wakeups = 0;   ///< passes that fired at least one timer
+    u32 fired   = 0;   ///< timers fired
+
+    // wakeups avoided compared to one wakeup per timer
+    [[nodiscard]] constexpr u32 saved() const noexcept { return fired - wakeups; }
+};
+
+#endif /* STM32_TOOLS_TIME_SCHEDULER_SLACK_H_ */
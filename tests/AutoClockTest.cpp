@@ -0,0 +1,152 @@
+/*
+ * AutoClockTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * AutoClockOf selection on mock sources with scripted read cost and step:
+ * lowest max(cost, resolution) wins, unavailable or rate-less sources are
+ * skipped, ties keep the earlier source, now() reads the winner modulo the
+ * narrowest type; Fixed<I> binds a source at compile time; then the host
+ * AutoClock on the real clocks
+ *
+ * Sources: LinuxClock.cpp
+ */
+
+#include "time/AutoClock.h"
+#include "time/tests/test_common.h"
+
+// every now() call moves the counter by Advance ticks, rate Hz
+template<typename T, u64 Hz, u32 Advance, bool Available = true, u32 Id = 0>
+struct MockSource
+{
+    using type_t = T;
+    static inline T t = 0;
+    static T now() noexcept { t = static_cast<T>(t + Advance); return t; }
+    static bool isAvailable() noexcept { return Available; }
+    static u64 ticksPerSecond() noexcept { return Hz; }
+};
+
+// 1 kHz tick: one step every 8 reads, cost 125 us but 1 ms resolution
+struct CoarseTick
+{
+    using type_t = u32;
+    static inline u32 reads = 0;
+    static type_t now() noexcept { return ++reads / 8u; }
+    static bool isAvailable() noexcept { return true; }
+    static u64 ticksPerSecond() noexcept { return 1000u; }
+};
+
+using Fast     = MockSource<u64, 1'000'000'000u, 20>;    // 20 ns read, 20 ns steps
+using SlowRead = MockSource<u32, 1'000'000'000u, 500>;   // 500 ns read
+using Missing  = MockSource<u32, 1'000'000'000u, 1, false>;
+using NoRate   = MockSource<u32, 0u, 1>;
+using FastTwin = MockSource<u64, 1'000'000'000u, 20, true, 1>;
+
+static void selection()
+{
+    using Clock = AutoClockOf<CoarseTick, SlowRead, Fast>;
+    CHECK(Clock::select());
+    CHECK_EQ(Clock::selected(), 2u);
+    CHECK_EQ(Clock::ticksPerSecond(), 1'000'000'000u);
+    CHECK_EQ(Clock::probe(0).resolutionNs, 1'000'000u);
+    CHECK_EQ(Clock::probe(0).costNs, 125'000u);
+    CHECK_EQ(Clock::probe(1).costNs, 500u);
+    CHECK_EQ(Clock::probe(2).costNs, 20u);
+    CHECK_EQ(Clock::probe(2).resolutionNs, 20u);
+
+    // type_t is the narrowest source: u32; the u64 winner is read modulo 2^32
+    static_assert(std::is_same_v<Clock::type_t, u32>);
+    Fast::t = 0xFFFF'FFFFull - 10u;
+    CHECK_EQ(Clock::now(), 9u);                 // 0x1'0000'0009
+    CHECK_EQ(Clock::fromNanos(1000u), 1000u);
+    CHECK_EQ(Clock::toNanos(1000u), 1000u);
+
+    // the coarse tick wins when it is the only usable source
+    using Fallback = AutoClockOf<Missing, NoRate, CoarseTick>;
+    CHECK(Fallback::select());
+    CHECK_EQ(Fallback::selected(), 2u);
+    CHECK(!Fallback::probe(0).available);
+    CHECK(!Fallback::probe(1).available);
+    CHECK_EQ(Fallback::ticksPerSecond(), 1000u);
+    CHECK_EQ(Fallback::fromNanos(1'500'000u), 2u);    // rounded up
+}
+
+static void edgeCases()
+{
+    using Twins = AutoClockOf<Fast, FastTwin>;
+    CHECK(Twins::select());
+    CHECK_EQ(Twins::selected(), 0u);            // tie: earlier source
+
+    using None = AutoClockOf<Missing, NoRate>;
+    CHECK(!None::select());
+    CHECK_EQ(None::ticksPerSecond(), 0u);
+
+    using Single = AutoClockOf<SlowRead>;
+    CHECK(Single::select());
+    SlowRead::t = 0;
+    CHECK_EQ(Single::now(), 500u);
+}
+
+static void fixed()
+{
+    using Clock = AutoClockOf<CoarseTick, SlowRead, Fast>;
+    using Fixed = Clock::Fixed<2>;
+    static_assert(std::is_same_v<Fixed::source, Fast>);
+    static_assert(std::is_same_v<Fixed::type_t, Clock::type_t>, "same wrap arithmetic as the probed clock");
+    static_assert(Fixed::selected() == 2u);
+
+    CHECK(Fixed::isAvailable());
+    Fast::t = 0xFFFF'FFFFull;
+    CHECK_EQ(Fixed::now(), 19u);                // read directly, modulo 2^32
+    CHECK_EQ(Fixed::ticksPerSecond(), 1'000'000'000u);
+    CHECK_EQ(Fixed::fromNanos(1000u), 1000u);
+    CHECK_EQ(Fixed::toNanos(1000u), 1000u);
+
+    // no probing: the coarse source can be pinned even though it would lose
+    using Coarse = Clock::Fixed<0>;
+    CHECK(Coarse::select());
+    CHECK_EQ(Coarse::ticksPerSecond(), 1000u);
+    CHECK_EQ(Coarse::fromNanos(1'500'000u), 2u);
+    CHECK_EQ(Coarse::toNanos(2u), 2'000'000u);
+
+    using Absent = AutoClockOf<Missing, Fast>::Fixed<0>;
+    using Rateless = AutoClockOf<NoRate, Fast>::Fixed<0>;
+    CHECK(!Absent::isAvailable());
+    CHECK(!Rateless::isAvailable());
+}
+
+static void host()
+{
+    CHECK(AutoClock::isAvailable());
+    CHECK(AutoClock::ticksPerSecond() > 0u);
+    const AutoClockProbe& p = AutoClock::probe(AutoClock::selected());
+    CHECK(p.available);
+    for (u8 i = 0; i < AutoClock::count; ++i) {
+        const AutoClockProbe& q = AutoClock::probe(i);
+        if (q.available) {
+            const u32 s  = (p.costNs > p.resolutionNs) ? p.costNs : p.resolutionNs;
+            const u32 sq = (q.costNs > q.resolutionNs) ? q.costNs : q.resolutionNs;
+            CHECK(s <= sq);
+        }
+        std::printf("  source %u: cost %u ns, resolution %u ns%s\n", i, q.costNs, q.resolutionNs,
+                    (i == AutoClock::selected()) ? " (selected)" : "");
+    }
+    const auto t0 = AutoClock::now();
+    const auto t1 = AutoClock::now();
+    CHECK(static_cast<AutoClock::type_t>(t1 - t0) < AutoClock::fromNanos(1'000'000u));
+
+    // a source of the build list pinned at compile time
+    using Pinned = AutoClockSources::Fixed<AutoClockSources::count - 1u>;
+    CHECK(Pinned::isAvailable());
+    CHECK(Pinned::ticksPerSecond() > 0u);
+}
+
+int main()
+{
+    selection();
+    edgeCases();
+    fixed();
+    host();
+    return test_result("AutoClockTest");
+}
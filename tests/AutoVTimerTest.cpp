@@ -0,0 +1,100 @@
+/*
+ * AutoVTimerTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * AutoVTimer: reload in the tick, overrun counting, bulk advance(n) == n ticks
+ *
+ * Sources: virtual/VTimer.cpp virtual/AutoVTimer.cpp
+ */
+
+#include "time/virtual/AutoVTimer.h"
+#include "time/virtual/VTimer.h"
+#include "time/tests/test_common.h"
+#include <memory>
+#include <vector>
+
+static void tick(const u32 n)
+{
+    for (u32 i = 0; i < n; ++i) {
+        HAL_SYSTICK_Callback();
+    }
+}
+
+static void reloadAndOverrun()
+{
+    AutoVTimer t(3);
+    tick(2);
+    CHECK(!t.isExpired());
+    tick(1);
+    CHECK(t.isExpired());           // one period
+    CHECK(!t.isExpired());          // consumed
+    tick(10);                       // main loop late: 3 periods elapsed (6, 9, 12)
+    CHECK_EQ(t.pending(), 3u);
+    CHECK_EQ(t.expirations(), 3u);
+    CHECK_EQ(t.timeLeft(), 2u);     // phase kept: next expiry at 15
+    tick(2);
+    CHECK_EQ(t.expirations(), 1u);
+
+    t.stop();
+    tick(10);
+    CHECK(t.isStopped());
+    CHECK_EQ(t.pending(), 0u);
+}
+
+struct State {
+    AutoVTimer::value_type left;
+    AutoVTimer::value_type pending;
+    VTimer::value_type     vleft;
+};
+
+// identical timer sets, one driven tick by tick, one with advance(n)
+static std::vector<State> runSet(const u32 ticks, const bool bulk, u64 seed)
+{
+    std::vector<std::unique_ptr<AutoVTimer>> autos;
+    std::vector<std::unique_ptr<VTimer>> plain;
+    for (u32 i = 0; i < 64; ++i) {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        const u32 period = static_cast<u32>(seed >> 58);     // 0..63, 0 = stopped
+        autos.emplace_back(new AutoVTimer(period));
+        plain.emplace_back(new VTimer(static_cast<u32>(seed >> 52) & 0x3FFu));
+    }
+
+    if (bulk) {
+        VTimer::advance(ticks);
+        AutoVTimer::advance(ticks);
+    } else {
+        tick(ticks);
+    }
+
+    std::vector<State> out;
+    for (u32 i = 0; i < autos.size(); ++i) {
+        out.push_back(State{autos[i]->timeLeft(), autos[i]->pending(), plain[i]->timeLeft()});
+    }
+    return out;
+}
+
+static void bulkEqualsTicks()
+{
+    u32 mismatches = 0;
+    for (u32 ticks : {0u, 1u, 2u, 63u, 64u, 100u, 1000u, 4097u}) {
+        for (u64 seed = 1; seed < 20; ++seed) {
+            const auto a = runSet(ticks, false, seed);
+            const auto b = runSet(ticks, true, seed);
+            for (u32 i = 0; i < a.size(); ++i) {
+                if (a[i].left != b[i].left || a[i].pending != b[i].pending || a[i].vleft != b[i].vleft) {
+                    ++mismatches;
+                }
+            }
+        }
+    }
+    CHECK_EQ(mismatches, 0u);
+}
+
+int main()
+{
+    reloadAndOverrun();
+    bulkEqualsTicks();
+    return test_result("AutoVTimerTest");
+}
@@ -0,0 +1,55 @@
+/*
+ * CachedClockBench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * One superloop pass of N isExpired() checks: timers on Monotonic (one
+ * clock read per check) against the same timers on CachedClock<Monotonic>
+ * (one refresh() per pass, plain loads after). Prints figures, always
+ * exits 0.
+ *
+ * Sources: LinuxClock.cpp
+ */
+
+#include "time/LinuxClock.h"
+#include "time/CachedClock.h"
+#include <chrono>
+#include <cstdio>
+#include <memory>
+
+using Clk = CachedClock<Monotonic>;
+
+static constexpr u32 passes = 20'000;
+
+template<class Timer, class Refresh>
+static double nsPerPass(const u32 n, Refresh&& refresh)
+{
+    auto timers = std::make_unique<Timer[]>(n);
+    for (u32 i = 0; i < n; ++i) {
+        timers[i].next(3'600'000'000'000ull);   // 1 h in ns: never expires here
+    }
+    volatile u32 expired = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (u32 p = 0; p < passes; ++p) {
+        refresh();
+        for (u32 i = 0; i < n; ++i) {
+            expired = expired + timers[i].isExpired();
+        }
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / passes;
+}
+
+int main()
+{
+    std::printf("CachedClockBench: %u passes\n", passes);
+    Clk::refresh();
+    for (const u32 n : {1u, 10u, 100u, 1000u}) {
+        const double direct = nsPerPass<MonoITimer<>>(n, [] {});
+        const double cached = nsPerPass<CachedITimer<Monotonic>>(n, [] { Clk::refresh(); });
+        std::printf("  %5u timers: Monotonic %9.1f ns/pass, CachedClock %8.1f ns/pass (x%.1f)\n",
+                    n, direct, cached, direct / cached);
+    }
+    return 0;
+}
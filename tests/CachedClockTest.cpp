@@ -0,0 +1,92 @@
+/*
+ * CachedClockTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * CachedClock: now() holds the last refresh() while the source moves, a
+ * Scope refreshes on entry and restores the interrupted snapshot on exit
+ * (nested too), Tags keep independent snapshots, timers on the clock see
+ * one instant per pass
+ */
+
+#include "time/CachedClock.h"
+#include "time/tests/test_common.h"
+
+struct ManualClock
+{
+    using type_t = u32;
+    static inline type_t t     = 0;
+    static inline u32    reads = 0;
+    static type_t now() noexcept { ++reads; return t; }
+    static bool isAvailable() noexcept { return true; }
+};
+
+struct Isr {};
+using Clk    = CachedClock<ManualClock>;
+using IsrClk = CachedClock<ManualClock, Isr>;
+
+static void snapshot()
+{
+    ManualClock::t = 100;
+    CHECK_EQ(Clk::refresh(), 100u);
+    ManualClock::t = 150;
+    CHECK_EQ(Clk::now(), 100u);                 // source moved, snapshot did not
+    CHECK_EQ(Clk::refresh(), 150u);
+    CHECK_EQ(Clk::now(), 150u);
+
+    CHECK_EQ(IsrClk::refresh(), 150u);          // Tag: own snapshot
+    ManualClock::t = 170;
+    Clk::refresh();
+    CHECK_EQ(IsrClk::now(), 150u);
+    CHECK_EQ(Clk::now(), 170u);
+}
+
+static void scope()
+{
+    ManualClock::t = 1000;
+    Clk::refresh();                             // main loop pass at 1000
+
+    ManualClock::t = 1010;
+    {
+        Clk::Scope isr;                         // handler preempts the pass
+        CHECK_EQ(isr.now(), 1010u);
+        CHECK_EQ(Clk::now(), 1010u);
+
+        ManualClock::t = 1020;
+        {
+            Clk::Scope nested;                  // higher-priority handler
+            CHECK_EQ(Clk::now(), 1020u);
+        }
+        CHECK_EQ(Clk::now(), 1010u);            // back to the outer handler's snapshot
+    }
+    CHECK_EQ(Clk::now(), 1000u);                // the pass never sees its time move
+}
+
+static void timers()
+{
+    ManualClock::t = 0;
+    Clk::refresh();
+    CachedITimer<ManualClock, 50u> a;
+    CachedITimer<ManualClock> b(50);
+    CachedOneShotI<ManualClock, 50u> c;
+    c.start();
+
+    ManualClock::t = 60;
+    CHECK(!a.isExpired() && !b.isExpired() && !c.isExpired());   // not refreshed yet
+
+    ManualClock::reads = 0;
+    Clk::refresh();
+    CHECK(a.isExpired());
+    CHECK(b.isExpired());
+    CHECK(c.isExpired());
+    CHECK_EQ(ManualClock::reads, 1u);           // one source read for the whole pass
+}
+
+int main()
+{
+    snapshot();
+    scope();
+    timers();
+    return test_result("CachedClockTest");
+}
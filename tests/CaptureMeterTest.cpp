@@ -0,0 +1,105 @@
+/*
+ * CaptureMeterTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * CaptureMeter on HostCapture: periods across the 16-bit counter wrap,
+ * many DMA ring laps read in time, averaging of a jittery signal, and
+ * overruns (N or more edges between reads) flagged and recovered from
+ */
+
+#include "time/capture/HostCapture.h"
+#include "time/tests/test_common.h"
+
+using Cap   = HostCapture<0>;
+using Meter = CaptureMeter<Cap, 16, 4>;
+
+static void counterWrap()
+{
+    Meter m;
+    CHECK(m.start());
+    CHECK_EQ(m.period(), 0u);                   // no edge yet
+    Cap::edge(0xFE00);
+    CHECK_EQ(m.average(), 0u);                  // one edge: no period
+    Cap::feedPeriodic(0xFE00 + 1000, 1000, 5);  // wraps after the first one
+    CHECK_EQ(m.period(), 1000u);
+    CHECK_EQ(m.average(), 1000u);
+    CHECK_EQ(m.filled(), 4u);
+    CHECK_EQ(m.edges(), 6u);
+    CHECK_EQ(m.frequency(1'000'000u), 1000u);
+    CHECK_EQ(m.overruns(), 0u);
+}
+
+static void ringWrap()
+{
+    Meter m;
+    CHECK(m.start());
+    u64 t = 0;
+    for (u32 k = 0; k < 40; ++k) {              // 40 reads x 15 edges: the ring laps 37 times
+        t = Cap::feedPeriodic(t, 500u + k, 15);
+        CHECK_EQ(m.period(), 500u + k);
+    }
+    CHECK_EQ(m.edges(), 600u);
+    CHECK_EQ(m.overruns(), 0u);
+    CHECK_EQ(m.average(), 539u);
+}
+
+static void jitter()
+{
+    Meter m;
+    CHECK(m.start());
+    static const u32 periods[] = {990, 1010, 1003, 997, 1020, 980};
+    u64 t = 0x1234;
+    Cap::edge(t);
+    for (const u32 p : periods) {
+        t += p;
+        Cap::edge(t);
+    }
+    CHECK_EQ(m.period(), 980u);
+    CHECK_EQ(m.average(), 1000u);               // last 4: 1003, 997, 1020, 980
+    CHECK_EQ(m.frequencyMilli(1'000'000u), 1'000'000u);
+}
+
+static void overrun()
+{
+    Meter m;
+    CHECK(m.start());
+    u64 t = Cap::feedPeriodic(0, 100, 10);
+    CHECK_EQ(m.average(), 100u);
+    CHECK_EQ(m.edges(), 10u);
+
+    // 20 edges unread: the ring lapped, the gap period is not measured
+    t = Cap::feedPeriodic(t + 7000, 300, 20);
+    CHECK_EQ(m.average(), 300u);
+    CHECK_EQ(m.period(), 300u);
+    CHECK_EQ(m.overruns(), 1u);
+    CHECK_EQ(m.edges(), 10u + 15u);             // the N - 1 newest
+
+    // exactly N edges: head back on the tail, still a lap
+    t = Cap::feedPeriodic(t + 9000, 200, 16);
+    CHECK_EQ(m.average(), 200u);
+    CHECK_EQ(m.overruns(), 2u);
+
+    // in-time reads afterwards: no new overrun, average follows
+    for (u32 k = 0; k < 5; ++k) {
+        t = Cap::feedPeriodic(t, 250, 15);
+        CHECK_EQ(m.average(), 250u);
+    }
+    CHECK_EQ(m.overruns(), 2u);
+
+    m.reset();
+    CHECK_EQ(m.overruns(), 0u);
+    CHECK_EQ(m.edges(), 0u);
+    m.stop();
+    CHECK(!m.isRunning());
+}
+
+int main()
+{
+    counterWrap();
+    ringWrap();
+    jitter();
+    overrun();
+    return test_result("CaptureMeterTest");
+}
@@ -0,0 +1,128 @@
+/*
+ * ClockSyncTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * ClockSync: 57 ppm drift under 20 us reference jitter with periodic
+ * outliers, a bad second pair, acceptance after a quiet period, reference step
+ */
+
+#include "time/ClockSync.h"
+#include "time/tests/test_common.h"
+#include <cmath>
+#include <random>
+
+struct Local { using type_t = u32; static type_t now() noexcept { return 0; } };
+using Sync = ClockSync<Local>;
+
+static constexpr double localHz = 168e6;
+static constexpr double skewPpm = 57.0;
+static constexpr double refT0   = 1e12;   // reference epoch, us
+
+// local counter at reference time t (us): 168 MHz + 57 ppm, wraps every ~25 s
+static u32 localAt(const double t)
+{
+    const double ticks = (t - refT0) * 1e-6 * localHz * (1.0 + skewPpm * 1e-6) + 12345.0;
+    return static_cast<u32>(static_cast<u64>(std::fmod(ticks, 4294967296.0)));
+}
+
+static Sync make(const u32 minGate = 0)
+{
+    return Sync(Sync::ratio(1'000'000u, 168'000'000u), minGate);
+}
+
+static void drift()
+{
+    std::mt19937_64 rng(3);
+    std::normal_distribution<double> jitter(0.0, 20.0);
+    Sync cs = make(50);
+
+    double maxErr = 0.0;
+    u32 rejected  = 0;
+    for (u32 s = 0; s < 600; ++s) {
+        const double t = refT0 + s * 1e6;
+        double meas = t + jitter(rng);
+        if (s % 97u == 50u) {
+            meas += 5000.0;     // outlier
+        }
+        if (!cs.update(localAt(t), static_cast<u64>(std::llround(meas)))) {
+            ++rejected;
+        }
+        if (s > 20u) {
+            for (u32 k = 1; k < 10; ++k) {
+                const double q = t + k * 1e5;
+                maxErr = std::fmax(maxErr, std::fabs(static_cast<double>(cs.toReference(localAt(q))) - q));
+            }
+        }
+    }
+    CHECK(cs.isLocked());
+    CHECK(maxErr < 60.0);
+    CHECK(rejected >= 6u && rejected <= 8u);                  // s = 50, 147, ..., 535 (+ 3-sigma noise)
+    CHECK(std::abs(cs.skewPpb() + 57'000) < 3'000);             // ref per local falls by ~57 ppm
+}
+
+static void badSecondPair()
+{
+    Sync cs = make();
+    CHECK(cs.update(localAt(refT0), static_cast<u64>(refT0)));
+    // 5 ms off after 1 s: 5000 ppm, must not become the rate
+    CHECK(!cs.update(localAt(refT0 + 1e6), static_cast<u64>(refT0 + 1e6 + 5000.0)));
+    CHECK_EQ(cs.rejected(), 1u);
+    CHECK(cs.update(localAt(refT0 + 2e6), static_cast<u64>(refT0 + 2e6)));
+    CHECK(std::abs(cs.skewPpb() + 57'000) < 2'000);
+
+    // first pair was the outlier: MaxRejects implausible pairs re-anchor
+    Sync re = make();
+    CHECK(re.update(localAt(refT0), static_cast<u64>(refT0 + 8000.0)));
+    CHECK(!re.update(localAt(refT0 + 1e6), static_cast<u64>(refT0 + 1e6)));
+    CHECK(!re.update(localAt(refT0 + 2e6), static_cast<u64>(refT0 + 2e6)));
+    CHECK(re.update(localAt(refT0 + 3e6), static_cast<u64>(refT0 + 3e6)));
+    CHECK(re.update(localAt(refT0 + 4e6), static_cast<u64>(refT0 + 4e6)));
+    CHECK(std::abs(re.skewPpb() + 57'000) < 2'000);
+}
+
+static void quietPeriod()
+{
+    // default minGate: after exact syncs the jitter estimate decays to ~0,
+    // a residual of a few local ticks must still be accepted
+    Sync cs = make();
+    const double t0 = refT0 + 0.25;
+    for (u32 s = 0; s < 200; ++s) {
+        const double t = t0 + s * 1e5;
+        cs.update(localAt(t), static_cast<u64>(std::llround(t)));
+    }
+    CHECK(cs.isLocked());
+    const u32 before = cs.rejected();
+    const double t = t0 + 200 * 1e5;
+    CHECK(cs.update(localAt(t), static_cast<u64>(std::llround(t)) + 1u));
+    CHECK_EQ(cs.rejected(), before);
+}
+
+static void referenceStep()
+{
+    Sync cs = make(50);
+    for (u32 s = 0; s < 20; ++s) {
+        const double t = refT0 + s * 1e6;
+        cs.update(localAt(t), static_cast<u64>(t));
+    }
+    const i32 skew = cs.skewPpb();
+    // reference jumps by +1 s: MaxRejects - 1 rejections, then re-anchor
+    for (u32 s = 20; s < 23; ++s) {
+        const double t = refT0 + s * 1e6;
+        const bool ok = cs.update(localAt(t), static_cast<u64>(t + 1e6));
+        CHECK(ok == (s == 22u));
+    }
+    CHECK_EQ(cs.skewPpb(), skew);   // rate kept
+    const double q = refT0 + 22.5e6;
+    CHECK(std::fabs(static_cast<double>(cs.toReference(localAt(q))) - (q + 1e6)) < 2.0);
+}
+
+int main()
+{
+    drift();
+    badSecondPair();
+    quietPeriod();
+    referenceStep();
+    return test_result("ClockSyncTest");
+}
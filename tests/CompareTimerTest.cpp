@@ -0,0 +1,139 @@
+/*
+ * CompareTimerTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * CompareTimer/CompareQueue on the mock compare channel: ordering, 16-bit
+ * counter wrap, past deadlines, cancel, callbacks re-arming timers (the host
+ * TimeLock is a non-recursive std::mutex)
+ */
+
+#include "time/compare/HostCompare.h"
+#include "time/tests/test_common.h"
+
+using Ch    = HostCompareChannel<0>;
+using Timer = CompareTimer<Ch>;
+using Queue = CompareQueue<Ch>;
+
+static u16 firedAt[8];
+static u32 fireCount[8];
+
+template<u32 I>
+static void record(Timer&)
+{
+    firedAt[I] = Ch::now();
+    ++fireCount[I];
+}
+
+static void clear()
+{
+    for (u32 i = 0; i < 8; ++i) {
+        firedAt[i]   = 0;
+        fireCount[i] = 0;
+    }
+}
+
+static void ordering()
+{
+    Ch::reset(1000);
+    clear();
+    Timer a(300, &record<0>), b(100, &record<1>), c(200, &record<2>);
+    a.start();
+    b.start();
+    c.start();
+    CHECK(Queue::head() == &b);
+    CHECK_EQ(Ch::compare(), 1100u);
+
+    Ch::step(350);
+    CHECK_EQ(firedAt[1], 1100u);
+    CHECK_EQ(firedAt[2], 1200u);
+    CHECK_EQ(firedAt[0], 1300u);
+    CHECK_EQ(Ch::interrupts(), 3u);
+    CHECK(a.isExpired());
+    CHECK(!a.isExpired());          // once
+    CHECK(!Ch::isEnabled());        // queue empty: interrupt off
+}
+
+static void wrap()
+{
+    Ch::reset(0xFFF0u);
+    clear();
+    Timer a(100, &record<0>);
+    a.start();
+    Ch::step(99);
+    CHECK_EQ(fireCount[0], 0u);
+    Ch::step(1);
+    CHECK_EQ(fireCount[0], 1u);
+    CHECK_EQ(firedAt[0], 0x0054u);
+    CHECK(!a.start(Timer::max_interval + 1u));   // beyond half the range
+}
+
+static void pastAndCancel()
+{
+    Ch::reset(500);
+    clear();
+    Timer a(0, &record<0>), b(50, &record<1>), c(80, &record<2>);
+    b.start();
+    c.start();
+    a.startAt(490);                 // already passed: forced through trigger()
+    Ch::serve();
+    CHECK_EQ(fireCount[0], 1u);
+    CHECK_EQ(firedAt[0], 500u);
+
+    b.stop();                       // head cancelled: CCR moves to c
+    CHECK(Queue::head() == &c);
+    CHECK_EQ(Ch::compare(), 580u);
+    Ch::step(100);
+    CHECK_EQ(fireCount[1], 0u);
+    CHECK_EQ(fireCount[2], 1u);
+
+    c.start(10);
+    c.stop();
+    CHECK(!Ch::isEnabled());
+    CHECK(c.isStopped());
+}
+
+// periodic through self re-arm, and a callback arming another timer
+static Timer* other = nullptr;
+
+static void periodic(Timer& t)
+{
+    ++fireCount[3];
+    if (fireCount[3] < 10u) {
+        t.start();                  // takes TimeLock: must not be held by onCompare()
+    }
+}
+
+static void kick(Timer&)
+{
+    ++fireCount[4];
+    other->start(5);
+}
+
+static void rearmFromCallback()
+{
+    Ch::reset(0xFF00u);             // periods cross the wrap
+    clear();
+    Timer p(50, &periodic);
+    Timer k(30, &kick);
+    Timer o(0, &record<5>);
+    other = &o;
+    p.start();
+    k.start();
+    Ch::step(1000);
+    CHECK_EQ(fireCount[3], 10u);
+    CHECK_EQ(fireCount[4], 1u);
+    CHECK_EQ(fireCount[5], 1u);
+    CHECK_EQ(firedAt[5], static_cast<u16>(0xFF00u + 35u));
+    CHECK(!Ch::isEnabled());
+}
+
+int main()
+{
+    ordering();
+    wrap();
+    pastAndCancel();
+    rearmFromCallback();
+    return test_result("CompareTimerTest");
+}
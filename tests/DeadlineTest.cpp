@@ -0,0 +1,116 @@
+/*
+ * DeadlineTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Deadline: expired()/remaining()/overdue() across the counter wrap (32 and
+ * 16-bit clocks), min/max/cap across a wrap, and conversion into dynamic
+ * ITimeBase/OneShotIBase timers and back
+ */
+
+#include "time/interval/ITimeBase.h"
+#include "time/interval/OneShotIBase.h"
+#include "time/tests/test_common.h"
+
+template<typename T>
+struct ManualClock {
+    using type_t = T;
+    static inline T t = 0;
+    static T now() noexcept { return t; }
+};
+
+using Clock   = ManualClock<u32>;
+using Clock16 = ManualClock<u16>;
+using DL      = Deadline<Clock>;
+
+static void wrap()
+{
+    Clock::t = 0xFFFF'FFF0u;
+    const DL dl = DL::in(0x20);                 // 0x10, past the wrap
+    CHECK_EQ(dl.instant(), 0x10u);
+    CHECK(!dl.expired());
+    CHECK_EQ(dl.remaining(), 0x20u);
+    CHECK_EQ(dl.overdue(Clock::now()), 0u);
+
+    Clock::t = 0xFFFF'FFFFu;
+    CHECK(!dl.expired());
+    CHECK_EQ(dl.remaining(), 0x11u);
+    Clock::t = 0x0Fu;
+    CHECK(!dl.expired());
+    CHECK_EQ(dl.remaining(), 1u);
+    Clock::t = 0x10u;
+    CHECK(dl.expired());
+    CHECK_EQ(dl.remaining(), 0u);
+    Clock::t = 0x30u;
+    CHECK(dl.expired());
+    CHECK_EQ(dl.remaining(), 0u);               // not a wrapped huge value
+    CHECK_EQ(dl.overdue(Clock::now()), 0x20u);
+
+    // 16-bit clock: same rules within half of 2^16
+    using DL16 = Deadline<Clock16>;
+    Clock16::t = 0xFF00u;
+    const DL16 d16 = DL16::in(0x0200u);         // 0x0100
+    CHECK(!d16.expired());
+    CHECK_EQ(d16.remaining(), 0x0200u);
+    CHECK(!d16.expired(0x00FFu));
+    CHECK(d16.expired(0x0100u));
+    CHECK(d16.expired(0x7FFFu));                // up to half the range late still reads expired
+}
+
+static void minMax()
+{
+    const DL a = DL::at(0xFFFF'FFF0u);          // before the wrap
+    const DL b = DL::at(0x10u);                 // after it: later, though numerically smaller
+    CHECK(DL::min(a, b) == a);
+    CHECK(DL::min(b, a) == a);
+    CHECK(DL::max(a, b) == b);
+    CHECK(a < b);
+    CHECK(b > a);
+    CHECK(a != b);
+
+    Clock::t = 0xFFFF'FFE0u;
+    const DL outer = DL::in(0x40);              // 0x20
+    CHECK(outer.cap(0x10) == DL::at(0xFFFF'FFF0u));   // cap tighter than the budget
+    CHECK(outer.cap(0x100) == outer);           // never extends the budget
+    CHECK_EQ(outer.cap(0x10).remaining(), 0x10u);
+}
+
+static void conversion()
+{
+    Clock::t = 0xFFFF'FF00u;
+    const DL dl = DL::in(0x180);                // 0x80, past the wrap
+
+    ITimeBase<0u, Clock> t = dl;                // implicit, armed to the remaining budget
+    CHECK_EQ(t.getInterval(), 0x180u);
+    OneShotIBase<0u, Clock> o = dl;
+    CHECK(!o.isStopped());
+
+    Clock::t = 0x7Fu;
+    CHECK(!t.isExpired());
+    CHECK(!o.isExpired());
+    CHECK_EQ(t.deadline().remaining(Clock::now()), 1u);
+    CHECK(o.deadline() == dl);
+    Clock::t = 0x80u;
+    CHECK(t.isExpired());
+    CHECK(o.isExpired());
+
+    // an already expired budget gives an already expired timer
+    ITimeBase<0u, Clock> late = DL::at(0x40u);
+    CHECK(late.isExpired());
+    CHECK_EQ(late.getInterval(), 0u);
+
+    // next(deadline) / start(deadline) re-arm from a budget
+    t.next(DL::in(50));
+    CHECK_EQ(t.timeLeft(), 50u);
+    o.start(DL::in(70));
+    CHECK_EQ(o.timeLeft(), 70u);
+}
+
+int main()
+{
+    wrap();
+    minMax();
+    conversion();
+    return test_result("DeadlineTest");
+}
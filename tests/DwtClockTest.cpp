@@ -0,0 +1,135 @@
+/*
+ * DwtClockTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * DwtClock::coreClockChanged() on a mock DWT: 168 -> 84 -> 336 MHz steps
+ * keep the time left and the period of stamp-based Dwt timers
+ *
+ * Dwt.cpp is included below, after the register mock it needs.
+ */
+
+#include "basic_types.h"
+
+// CMSIS mock: the cycle counter is a plain variable advanced by the test
+struct MockDwt       { volatile u32 CTRL; volatile u32 CYCCNT; volatile u32 LAR; };
+struct MockCoreDebug { volatile u32 DEMCR; };
+inline MockDwt       mockDwt{};
+inline MockCoreDebug mockCoreDebug{};
+inline u32           SystemCoreClock = 168'000'000u;
+
+#define DWT                          (&mockDwt)
+#define DWT_BASE                     0u
+#define CoreDebug                    (&mockCoreDebug)
+#define CoreDebug_DEMCR_TRCENA_Msk   (1u << 24)
+#define DWT_CTRL_CYCCNTENA_Msk       (1u << 0)
+#define SET_BIT(r, b)                ((r) |= (b))
+#define READ_BIT(r, b)               ((r) & (b))
+#define __STATIC_INLINE              static inline
+
+#include "time/DwtClock.h"
+#include "time/Dwt.cpp"
+#include "time/tests/test_common.h"
+
+static void elapse(const u32 us)
+{
+    mockDwt.CYCCNT = mockDwt.CYCCNT + static_cast<u32>(static_cast<u64>(us) * SystemCoreClock / 1'000'000u);
+}
+
+static void step(const u32 hz)
+{
+    const u32 old = SystemCoreClock;
+    SystemCoreClock = hz;
+    DwtClock::coreClockChanged(old);
+}
+
+static void periodic()
+{
+    mockDwt.CYCCNT = 0xFFFF'0000u;   // wraps during the test
+    ScaledDwtITimer t;
+    t.next(DwtBuilder::from_micro(1000));
+
+    elapse(400);
+    step(84'000'000u);                        // half the clock: 600 us left = 50'400 cycles
+    CHECK_EQ(t.getInterval(), 84'000u);
+    elapse(599);
+    CHECK(!t.isExpired());
+    elapse(1);
+    CHECK(t.isExpired());                     // 1000 us after start, not 1600 or 700
+
+    // next period runs the rescaled interval
+    t.next();
+    elapse(500);
+    step(336'000'000u);                       // 500 us left = 168'000 cycles
+    CHECK_EQ(t.getInterval(), 336'000u);
+    elapse(499);
+    CHECK(!t.isExpired());
+    elapse(1);
+    CHECK(t.isExpired());
+}
+
+static void oneShot()
+{
+    SystemCoreClock = 168'000'000u;
+    ScaledOneShotIDwt o;
+    o.start(DwtBuilder::from_micro(200));
+    elapse(50);
+    step(84'000'000u);
+    elapse(149);
+    CHECK(!o.isExpired());
+    elapse(1);
+    CHECK(o.isExpired());
+    CHECK(!o.isExpired());                    // latched: fires once
+
+    // unregistered timers keep raw cycles (and run long after a slow-down)
+    DwtITimer<> raw;
+    raw.next(DwtBuilder::from_micro(100));
+    step(42'000'000u);
+    elapse(100);
+    CHECK(!raw.isExpired());
+    elapse(100);
+    CHECK(raw.isExpired());
+}
+
+// DwtScaled over a plain DwtITimer (no stretch word) rescales the same way
+static void plain()
+{
+    SystemCoreClock = 168'000'000u;
+    DwtScaled<DwtITimer<>> t;
+    t.next(DwtBuilder::from_micro(1000));
+    elapse(250);
+    step(84'000'000u);
+    CHECK_EQ(t.getInterval(), 84'000u);
+    elapse(749);
+    CHECK(!t.isExpired());
+    elapse(1);
+    CHECK(t.isExpired());
+}
+
+static void registry()
+{
+    SystemCoreClock = 100'000'000u;
+    {
+        ScaledDwtITimer a;
+        a.next(1000u);
+        {
+            ScaledDwtITimer b;
+            b.next(3000u);
+            step(200'000'000u);
+            CHECK_EQ(b.getInterval(), 6000u);
+        }
+        step(100'000'000u);                   // b is gone, only a is visited
+        CHECK_EQ(a.getInterval(), 1000u);
+    }
+    step(50'000'000u);                        // empty registry: nothing left to visit
+}
+
+int main()
+{
+    periodic();
+    oneShot();
+    plain();
+    registry();
+    return test_result("DwtClockTest");
+}
@@ -0,0 +1,110 @@
+/*
+ * EdfDispatcherBench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * EdfDispatcher::poll() against a linear isExpired() scan over dynamic
+ * ITimeBase timers, 10 ... 10,000 periodic timers (periods 1000..9999
+ * ticks) on a manual clock stepped one tick per pass; the last column lets
+ * the EDF loop jump straight to nextDue(). Prints figures, always exits 0.
+ */
+
+#include "time/interval/ITimeBase.h"
+#include "time/scheduler/EdfDispatcher.h"
+#include <chrono>
+#include <cstdio>
+#include <memory>
+
+struct BenchClock {
+    using type_t = u32;
+    static inline u32 t = 0;
+    static u32 now() noexcept { return t; }
+};
+
+static constexpr u16 maxTimers = 10'000;
+static constexpr u32 ticks     = 20'000;
+
+using Edf   = EdfDispatcher<BenchClock, maxTimers>;
+using Timer = ITimeBase<0u, BenchClock>;
+
+static u32 period(const u32 i) { return 1000u + (i * 7919u) % 9000u; }
+
+static u64 fired = 0;
+
+template<class Fn>
+static double nsPerTick(Fn&& fn)
+{
+    const auto t0 = std::chrono::steady_clock::now();
+    fn();
+    const auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / ticks;
+}
+
+static void compare(const u32 n)
+{
+    // linear: every timer checked on every pass
+    BenchClock::t = 0;
+    fired = 0;
+    auto timers = std::make_unique<Timer[]>(n);
+    for (u32 i = 0; i < n; ++i) {
+        timers[i].next(period(i));
+    }
+    const double linear = nsPerTick([&] {
+        for (u32 k = 0; k < ticks; ++k) {
+            ++BenchClock::t;
+            for (u32 i = 0; i < n; ++i) {
+                if (timers[i].isExpired()) {
+                    timers[i].next();
+                    ++fired;
+                }
+            }
+        }
+    });
+    const u64 linearFired = fired;
+
+    // EDF: one heap root check per pass, O(log N) per due task
+    static Edf edf;
+    static Edf::Task tasks[maxTimers];
+    BenchClock::t = 0;
+    fired = 0;
+    for (u32 i = 0; i < n; ++i) {
+        tasks[i].setCallback(+[](Edf::Task&) { ++fired; });
+        edf.startPeriodic(tasks[i], period(i));
+    }
+    const double edfPoll = nsPerTick([&] {
+        for (u32 k = 0; k < ticks; ++k) {
+            ++BenchClock::t;
+            edf.poll();
+        }
+    });
+    const u64 edfFired = fired;
+
+    // EDF, sleeping until nextDue(): the clock jumps between wakeups
+    edf.clear();
+    BenchClock::t = 0;
+    for (u32 i = 0; i < n; ++i) {
+        edf.startPeriodic(tasks[i], period(i));
+    }
+    const double edfSleep = nsPerTick([&] {
+        while (BenchClock::t < ticks) {
+            BenchClock::t += edf.nextDue();
+            edf.poll();
+        }
+    });
+    edf.clear();
+
+    std::printf("  %6u timers: linear %9.1f ns/tick, EDF %7.1f ns/tick, EDF+nextDue %7.1f ns/tick"
+                " (%llu / %llu fired)\n",
+                n, linear, edfPoll, edfSleep,
+                static_cast<unsigned long long>(linearFired), static_cast<unsigned long long>(edfFired));
+}
+
+int main()
+{
+    std::printf("EdfDispatcherBench: %u ticks\n", ticks);
+    for (const u32 n : {10u, 100u, 1000u, 10000u}) {
+        compare(n);
+    }
+    return 0;
+}
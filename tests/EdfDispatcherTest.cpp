@@ -0,0 +1,259 @@
+/*
+ * EdfDispatcherTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * EdfDispatcher on a settable clock: deadline order, wrap-safe keys on a
+ * 16-bit clock, cancel/re-arm, nextDue(), a callback re-arming with
+ * interval 0 runs once per poll(), slack coalescing, cancel of a due task
+ * from an earlier callback of the same pass
+ */
+
+#include "time/scheduler/EdfDispatcher.h"
+#include "time/tests/test_common.h"
+
+template<typename T>
+struct ManualClock {
+    using type_t = T;
+    static inline T t = 0;
+    static T now() noexcept { return t; }
+};
+
+using Clock = ManualClock<u32>;
+using Edf   = EdfDispatcher<Clock, 16>;
+using Task  = Edf::Task;
+
+static Edf  edf;
+static char order[16];
+static u32  ran = 0;
+
+static void logRun(Task& t);
+
+static Task a(&logRun), b(&logRun), c(&logRun);
+
+static void logRun(Task& t)
+{
+    order[ran++] = static_cast<char>('a' + (&t == &b) + 2 * (&t == &c));
+    order[ran]   = '\0';
+}
+
+static void reset()
+{
+    edf.clear();
+    edf.resetStats();
+    ran = 0;
+    order[0] = '\0';
+    Clock::t = 1000;
+}
+
+static bool orderIs(const char* s)
+{
+    for (u32 i = 0; ; ++i) {
+        if (order[i] != s[i]) {
+            return false;
+        }
+        if (s[i] == '\0') {
+            return true;
+        }
+    }
+}
+
+static void ordering()
+{
+    reset();
+    CHECK(edf.start(a, 30));
+    CHECK(edf.start(b, 10));
+    CHECK(edf.start(c, 20));
+    CHECK_EQ(edf.size(), 3u);
+    CHECK(edf.top() == &b);
+
+    Clock::t += 9;
+    CHECK_EQ(edf.poll(), 0u);
+    Clock::t += 21;
+    CHECK_EQ(edf.poll(), 3u);                   // all due: run in deadline order
+    CHECK(orderIs("bca"));
+    CHECK(edf.empty());
+    CHECK(!a.isQueued() && !b.isQueued() && !c.isQueued());
+
+    // periodic: phase-locked, missed periods skipped
+    reset();
+    CHECK(edf.startPeriodic(a, 10));
+    Clock::t += 35;
+    CHECK_EQ(edf.poll(), 1u);
+    CHECK_EQ(a.deadline(), 1040u);
+    CHECK(a.isQueued());
+    edf.cancel(a);
+}
+
+static void wrap()
+{
+    using Clock16 = ManualClock<u16>;
+    using Edf16   = EdfDispatcher<Clock16, 4>;
+    static Edf16 e;
+    static u32 fired = 0;
+    Edf16::Task x(+[](Edf16::Task&) { fired += 1u; });
+    Edf16::Task y(+[](Edf16::Task&) { fired += 10u; });
+
+    Clock16::t = 0xFFF0u;
+    CHECK(e.start(x, 0x20));                    // deadline 0x0010
+    CHECK(e.start(y, 0x08));                    // deadline 0xFFF8
+    CHECK(e.top() == &y);
+    CHECK_EQ(e.nextDue(), 0x08u);
+
+    Clock16::t = 0x0002u;                       // past the wrap
+    CHECK_EQ(e.poll(), 1u);
+    CHECK_EQ(fired, 10u);
+    CHECK_EQ(e.nextDue(), 0x0Eu);
+    Clock16::t = 0x0010u;
+    CHECK_EQ(e.poll(), 1u);
+    CHECK_EQ(fired, 11u);
+    CHECK(e.empty());
+}
+
+static void cancelRearm()
+{
+    reset();
+    CHECK(edf.start(a, 10));
+    CHECK(edf.start(b, 20));
+    edf.cancel(a);
+    edf.cancel(a);                              // not queued: no-op
+    CHECK(!a.isQueued());
+    CHECK_EQ(edf.size(), 1u);
+
+    CHECK(edf.start(b, 5));                     // re-arm earlier, stays one entry
+    CHECK_EQ(edf.size(), 1u);
+    CHECK_EQ(edf.nextDue(), 5u);
+    CHECK(edf.start(a, 3));
+    CHECK(edf.startAt(a, Clock::t + 50));       // re-arm later
+    CHECK(edf.top() == &b);
+
+    Clock::t += 5;
+    CHECK_EQ(edf.poll(), 1u);
+    CHECK(orderIs("b"));
+    CHECK_EQ(edf.nextDue(), 45u);
+    edf.clear();
+    CHECK(!a.isQueued());
+}
+
+static void nextDue()
+{
+    reset();
+    CHECK_EQ(edf.nextDue(), Edf::never);
+    CHECK(edf.start(a, 7));
+    CHECK_EQ(edf.nextDue(), 7u);
+    Clock::t += 7;
+    CHECK_EQ(edf.nextDue(), 0u);
+    Clock::t += 100;
+    CHECK_EQ(edf.nextDue(), 0u);                // overdue reads 0, not a wrapped delay
+    CHECK(edf.start(b, 3, 4));
+    edf.cancel(a);
+    CHECK_EQ(edf.nextDue(), 7u);                // slack: wakes at deadline + slack
+    edf.clear();
+}
+
+// interval 0 from the callback: due again at once, but only in the next poll()
+static void selfRearm()
+{
+    reset();
+    static u32 runs = 0;
+    runs = 0;
+    Task t(+[](Task& self) { ++runs; edf.start(self, 0); });
+    CHECK(edf.start(t, 0));
+    CHECK_EQ(edf.poll(), 1u);
+    CHECK_EQ(runs, 1u);
+    CHECK(t.isQueued());
+    CHECK_EQ(edf.nextDue(), 0u);
+    CHECK_EQ(edf.poll(), 1u);
+    CHECK_EQ(runs, 2u);
+    edf.cancel(t);
+
+    // coalesced tasks re-arming themselves are not run twice either
+    Task s(+[](Task& self) { ++runs; edf.start(self, 0, 5); });
+    runs = 0;
+    CHECK(edf.start(a, 2));
+    CHECK(edf.start(s, 1, 5));
+    Clock::t += 2;
+    CHECK_EQ(edf.poll(), 2u);
+    CHECK_EQ(runs, 1u);
+    CHECK(s.isQueued());
+    edf.clear();
+}
+
+static void coalescing()
+{
+    reset();
+    CHECK(edf.start(a, 5, 10));                 // window [1005, 1015]
+    CHECK(edf.start(c, 30, 10));                // window [1030, 1040]: not open yet
+    CHECK(edf.start(b, 8));
+    CHECK(edf.top() == &b);
+
+    Clock::t += 8;
+    CHECK_EQ(edf.poll(), 2u);                   // b due, a joins its wakeup
+    CHECK(orderIs("ba"));
+    CHECK(c.isQueued());
+    CHECK_EQ(edf.size(), 1u);
+    CHECK_EQ(edf.stats().wakeups, 1u);
+    CHECK_EQ(edf.stats().fired, 2u);
+
+    Clock::t += 30;
+    CHECK_EQ(edf.poll(), 0u);                   // c's window open, not forced yet
+    Clock::t += 2;
+    CHECK_EQ(edf.poll(), 1u);
+    CHECK(edf.empty());
+
+    // the heap stays valid after the coalescing partition
+    reset();
+    Task more[8];
+    for (u32 i = 0; i < 8u; ++i) {
+        CHECK(edf.start(more[i], 10 + i, (i & 1u) ? 20u : 0u));
+    }
+    Clock::t += 14;
+    CHECK_EQ(edf.poll(), 3u + 2u);              // 1010, 1012, 1014 due; windows from 1011, 1013 open
+    for (u32 i = 0; i < 8u; ++i) {
+        CHECK_EQ(more[i].isQueued(), i >= 5u);
+    }
+    CHECK(edf.top() == &more[6]);
+    CHECK_EQ(edf.nextDue(), 2u);
+    edf.clear();
+}
+
+// a callback cancels a task that is due in the same pass
+static void cancelDue()
+{
+    reset();
+    a.setCallback(+[](Task& t) { logRun(t); edf.cancel(b); });
+    CHECK(edf.start(a, 1));
+    CHECK(edf.start(b, 2));
+    CHECK(edf.start(c, 3));
+    Clock::t += 3;
+    CHECK_EQ(edf.poll(), 2u);
+    CHECK(orderIs("ac"));
+    CHECK(!b.isQueued());
+
+    // ... or re-arms it: it runs at its new deadline, not in this pass
+    a.setCallback(+[](Task& t) { logRun(t); edf.start(b, 4); });
+    ran = 0;
+    CHECK(edf.start(a, 1));
+    CHECK(edf.start(b, 2));
+    Clock::t += 2;
+    CHECK_EQ(edf.poll(), 1u);
+    CHECK(orderIs("a"));
+    CHECK(b.isQueued());
+    Clock::t += 4;
+    CHECK_EQ(edf.poll(), 1u);
+    CHECK(orderIs("ab"));
+    a.setCallback(&logRun);
+}
+
+int main()
+{
+    ordering();
+    wrap();
+    cancelRearm();
+    nextDue();
+    selfRearm();
+    coalescing();
+    cancelDue();
+    return test_result("EdfDispatcherTest");
+}
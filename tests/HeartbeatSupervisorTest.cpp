@@ -0,0 +1,139 @@
+/*
+ * HeartbeatSupervisorTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * HeartbeatSupervisor starvation: a task that stops beating is reported at
+ * the first check() past its deadline, with the right lateness, also across
+ * the counter wrap; healthy tasks keep check() O(1) (few full scans)
+ */
+
+#include "time/scheduler/HeartbeatSupervisor.h"
+#include "time/tests/test_common.h"
+
+template<typename T>
+struct ManualClock
+{
+    using type_t = T;
+    static inline type_t t = 0;
+    static type_t now() noexcept { return t; }
+};
+
+using Clock32 = ManualClock<u32>;
+using Clock16 = ManualClock<u16>;
+
+static void healthy()
+{
+    Clock32::t = 0;
+    HeartbeatSupervisor<Clock32, 8> sup;
+    for (u16 i = 0; i < 8; ++i) {
+        sup.enable(i, 50u + i * 10u);
+    }
+    for (u32 t = 1; t <= 10'000u; ++t) {
+        Clock32::t = t;
+        sup.beat(static_cast<u16>(t % 8u));     // each task every 8 ticks
+        CHECK(sup.check());
+    }
+    CHECK_EQ(sup.stats().checks, 10'000u);
+    CHECK(sup.stats().scans < sup.stats().checks / 20u);
+    CHECK_EQ(sup.starved().task, sup.none);
+}
+
+static void starvation()
+{
+    Clock32::t = 1000;
+    HeartbeatSupervisor<Clock32, 4> sup;
+    sup.enable(0, 100);
+    sup.enable(1, 100);
+    sup.enable(2, 40);
+
+    // task 2 beats last at 1200: deadline 1240
+    u32 t = 1000;
+    for (; t < 1200u; ++t) {
+        Clock32::t = t;
+        sup.beat(0);
+        sup.beat(1);
+        sup.beat(2);
+        CHECK(sup.check());
+    }
+    Clock32::t = t;
+    sup.beat(2);
+    for (; t < 1240u; ++t) {
+        Clock32::t = t;
+        sup.beat(0);
+        sup.beat(1);
+        CHECK(sup.check());
+    }
+    Clock32::t = 1240;                          // first check at the deadline
+    CHECK(!sup.check());
+    CHECK_EQ(sup.starved().task, 2u);
+    CHECK_EQ(sup.starved().overdue, 0u);
+
+    // checks resume 25 ticks later: lateness reported
+    Clock32::t = 1265;
+    sup.beat(0);
+    sup.beat(1);
+    CHECK(!sup.check());
+    CHECK_EQ(sup.starved().task, 2u);
+    CHECK_EQ(sup.starved().overdue, 25u);
+
+    // the most overdue task wins
+    Clock32::t = 1400;                          // 0 and 1 due at 1365, 2 at 1240
+    CHECK(!sup.check());
+    CHECK_EQ(sup.starved().task, 2u);
+    CHECK_EQ(sup.starved().overdue, 160u);
+
+    sup.disable(2);
+    CHECK(!sup.check());
+    CHECK_EQ(sup.starved().task, 0u);
+    CHECK_EQ(sup.starved().overdue, 35u);
+    sup.beat(0);
+    sup.beat(1);
+    CHECK(sup.check());                         // recovered
+
+    // a short timeout enabled after the bound was taken is still seen
+    sup.enable(3, 5);
+    Clock32::t = 1404;
+    CHECK(sup.check());
+    Clock32::t = 1405;
+    CHECK(!sup.check());
+    CHECK_EQ(sup.starved().task, 3u);
+}
+
+static void wrap()
+{
+    Clock16::t = 0xFF00u;
+    HeartbeatSupervisor<Clock16, 2> sup;
+    sup.enable(0, 0x80u);
+    sup.enable(1, 0x400u);
+    for (u32 i = 0; i < 0x200u; ++i) {          // runs through 0xFFFF -> 0
+        Clock16::t = static_cast<u16>(Clock16::t + 1u);
+        sup.beat(0);
+        sup.beat(1);
+        CHECK(sup.check());
+    }
+    const u16 last = Clock16::t;                // 0x0100
+    for (u32 i = 0; i < 0x80u; ++i) {
+        Clock16::t = static_cast<u16>(Clock16::t + 1u);
+        sup.beat(1);                            // task 0 starves
+        if (i + 1u < 0x80u) {
+            CHECK(sup.check());
+        }
+    }
+    CHECK(!sup.check());
+    CHECK_EQ(sup.starved().task, 0u);
+    CHECK_EQ(static_cast<u16>(last + 0x80u), Clock16::t);
+
+    CHECK_EQ(sup.active(), 2u);
+    sup.enable(0, 0x8000u);                     // rejected: half the range
+    CHECK_EQ(sup.deadline(0), static_cast<u16>(last + 0x80u));
+}
+
+int main()
+{
+    healthy();
+    starvation();
+    wrap();
+    return test_result("HeartbeatSupervisorTest");
+}
@@ -0,0 +1,89 @@
+/*
+ * HostTickBench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Registry lock policies (uncontended and against a running HostTick) and
+ * HostTick rate accuracy
+ *
+ * Sources: HostTick.cpp virtual/VTimer.cpp virtual/AutoVTimer.cpp
+ */
+
+#include "time/HostTick.h"
+#include "time/lock_policy.h"
+#include "time/virtual/VTimer.h"
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+template<class Lock>
+static double lockNs(const u32 n)
+{
+    volatile u32 sink = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (u32 i = 0; i < n; ++i) {
+        Lock guard;
+        sink = sink + 1u;
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+}
+
+// next() + isExpired() on 64 VTimers while the tick thread scans them
+static double rearmNs(const u32 n)
+{
+    std::vector<std::unique_ptr<VTimer>> timers;
+    for (u32 i = 0; i < 64; ++i) {
+        timers.emplace_back(new VTimer(5));
+    }
+    const auto t0 = std::chrono::steady_clock::now();
+    for (u32 i = 0; i < n; ++i) {
+        VTimer& t = *timers[i & 63u];
+        if (t.isExpired()) {
+            t.next(5);
+        }
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+}
+
+static void rate(const std::chrono::microseconds period)
+{
+    HostTick::start(period);
+    const u32 a = HostTick::now();
+    const auto t0 = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(500ms);
+    const u32 b = HostTick::now();
+    const auto t1 = std::chrono::steady_clock::now();
+    HostTick::stop();
+
+    const double expected = std::chrono::duration<double>(t1 - t0).count() * HostTick::ticksPerSecond();
+    std::printf("  HostTick %5lld us: %u ticks in %.3f s (expected %.0f, %+.2f%%)\n",
+                static_cast<long long>(period.count()), b - a,
+                std::chrono::duration<double>(t1 - t0).count(), expected,
+                100.0 * ((b - a) - expected) / expected);
+}
+
+int main()
+{
+    constexpr u32 n = 10'000'000;
+    std::printf("lock + unlock, uncontended:\n");
+    std::printf("  NoLock       %6.2f ns\n", lockNs<NoLock>(n));
+    std::printf("  StdMutexLock %6.2f ns\n", lockNs<StdMutexLock>(n));
+    std::printf("  SpinLock     %6.2f ns\n", lockNs<SpinLock>(n));
+
+    HostTick::start(100us);
+    std::printf("with HostTick at 10 kHz:\n");
+    std::printf("  StdMutexLock %6.2f ns\n", lockNs<StdMutexLock>(n));
+    std::printf("  SpinLock     %6.2f ns\n", lockNs<SpinLock>(n));
+    std::printf("  VTimer isExpired/next %6.2f ns\n", rearmNs(n));
+    HostTick::stop();
+
+    std::printf("tick rate:\n");
+    rate(1ms);
+    rate(100us);
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*
+ * HostTickTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * HostTick: start()/stop() cycles, restart from inside the tick callback,
+ * start()/stop() racing from several threads
+ *
+ * Sources: HostTick.cpp   (HAL_SYSTICK_Callback is defined here, not VTimer.cpp)
+ */
+
+#include "time/HostTick.h"
+#include "time/tests/test_common.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+static std::atomic<u32> callbacks{0};
+static std::atomic<u32> restartAt{0};    // callback number that restarts the driver
+static std::atomic<u32> restarts{0};
+
+void HAL_SYSTICK_Callback(void)
+{
+    const u32 n = callbacks.fetch_add(1u) + 1u;
+    if (n == restartAt.load()) {
+        HostTick::stop();                // from the driver thread itself
+        HostTick::start(100us);
+        restarts.fetch_add(1u);
+    }
+}
+
+static void waitTicks(const u32 n)
+{
+    const u32 target = callbacks.load() + n;
+    for (u32 i = 0; i < 2000 && callbacks.load() < target; ++i) {
+        std::this_thread::sleep_for(1ms);
+    }
+}
+
+static void cycles()
+{
+    for (u32 i = 0; i < 100; ++i) {
+        CHECK(HostTick::start(100us));
+        CHECK(HostTick::start(100us));   // already running: no second driver
+        CHECK(HostTick::isRunning());
+        HostTick::stop();
+        CHECK(!HostTick::isRunning());
+    }
+    HostTick::start(100us);
+    const u32 before = callbacks.load();
+    waitTicks(20);
+    CHECK(callbacks.load() >= before + 20u);
+    HostTick::stop();
+}
+
+static void restartFromCallback()
+{
+    HostTick::start(100us);
+    for (u32 i = 0; i < 20; ++i) {
+        restartAt.store(callbacks.load() + 5u);
+        const u32 r = restarts.load();
+        for (u32 k = 0; k < 2000 && restarts.load() == r; ++k) {
+            std::this_thread::sleep_for(1ms);
+        }
+        CHECK_EQ(restarts.load(), r + 1u);
+        CHECK(HostTick::isRunning());
+    }
+    restartAt.store(0);
+    const u32 before = callbacks.load();
+    waitTicks(20);
+    CHECK(callbacks.load() >= before + 20u);   // the new driver ticks
+    HostTick::stop();
+}
+
+static void racing()
+{
+    std::atomic<bool> done{false};
+    std::vector<std::thread> th;
+    for (u32 t = 0; t < 4; ++t) {
+        th.emplace_back([&, t] {
+            u32 rng = t + 1u;
+            while (!done.load()) {
+                rng = rng * 1664525u + 1013904223u;
+                if (rng & 0x100u) {
+                    HostTick::start(100us);
+                } else {
+                    HostTick::stop();
+                }
+            }
+        });
+    }
+    std::this_thread::sleep_for(300ms);
+    done.store(true);
+    for (auto& x : th) {
+        x.join();
+    }
+    HostTick::stop();
+    CHECK(!HostTick::isRunning());
+
+    // still usable afterwards
+    HostTick::start(100us);
+    const u32 before = callbacks.load();
+    waitTicks(20);
+    CHECK(callbacks.load() >= before + 20u);
+    HostTick::stop();
+}
+
+int main()
+{
+    cycles();
+    restartFromCallback();
+    racing();
+    return test_result("HostTickTest");
+}
@@ -0,0 +1,140 @@
+/*
+ * HostTimerServiceBench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * HostTimerService figures for 1/2/4/8 threads:
+ *  - throughput: 20000 one-shot timers re-armed at 0 from their callback
+ *  - latency:    20000 periodic timers spread over 10 ms, callback start
+ *                minus deadline (p50/p99/max)
+ * Every callback does ~0.3 us of work. Prints figures, always exits 0.
+ */
+
+#include "time/HostTimerService.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using Service = HostTimerService<>;
+
+static constexpr u32 timers   = 20'000u;
+static constexpr u64 warmupNs = 200'000'000ull;
+static constexpr u64 runNs    = 1'000'000'000ull;
+
+static void work() noexcept
+{
+    volatile u32 x = 0;
+    for (u32 i = 0; i < 100u; ++i) {
+        x = x + i;
+    }
+}
+
+static Service* svc = nullptr;
+
+static void rearm(HostTimer& t)
+{
+    work();
+    svc->arm(t, 0);
+}
+
+static double throughput(const unsigned threads)
+{
+    Service s(threads);
+    svc = &s;
+    std::vector<HostTimer> ts(timers);
+    for (auto& t : ts) {
+        t.setCallback(rearm);
+    }
+    s.start();
+    for (auto& t : ts) {
+        s.arm(t, 0);
+    }
+    std::this_thread::sleep_for(std::chrono::nanoseconds(warmupNs));
+    const u64 f0 = s.stats().fired;
+    const u64 t0 = Monotonic::now();
+    std::this_thread::sleep_for(std::chrono::nanoseconds(runNs));
+    const u64 f1 = s.stats().fired;
+    const u64 t1 = Monotonic::now();
+    for (auto& t : ts) {
+        s.cancelSync(t);
+    }
+    s.stop();
+    return static_cast<double>(f1 - f0) * 1e9 / static_cast<double>(t1 - t0);
+}
+
+// per-thread latency samples, merged at the end
+static std::mutex           samplesLock;
+static std::vector<u64>     samples;
+static std::atomic<bool>    recording{false};
+static thread_local std::vector<u64>* local = nullptr;
+static std::vector<std::unique_ptr<std::vector<u64>>> locals;
+
+static void measure(HostTimer& t)
+{
+    const u64 now = Monotonic::now();
+    work();
+    if (!recording.load(std::memory_order_relaxed)) {
+        return;
+    }
+    if (local == nullptr) {
+        std::lock_guard<std::mutex> g(samplesLock);
+        locals.emplace_back(std::make_unique<std::vector<u64>>());
+        local = locals.back().get();
+        local->reserve(1u << 22);
+    }
+    local->push_back(now - t.deadline());
+}
+
+static void latency(const unsigned threads)
+{
+    constexpr u64 period = 10'000'000ull;   // 10 ms: 2 M callbacks/s offered
+    Service s(threads);
+    std::vector<HostTimer> ts(timers);
+    for (auto& t : ts) {
+        t.setCallback(measure);
+    }
+    s.start();
+    const u64 base = Monotonic::now() + 1'000'000ull;
+    for (u32 i = 0; i < timers; ++i) {
+        s.armAt(ts[i], base + (period * i) / timers, period);
+    }
+    std::this_thread::sleep_for(std::chrono::nanoseconds(warmupNs));
+    recording = true;
+    std::this_thread::sleep_for(std::chrono::nanoseconds(runNs));
+    recording = false;
+    for (auto& t : ts) {
+        s.cancelSync(t);
+    }
+    s.stop();
+
+    samples.clear();
+    for (auto& l : locals) {
+        samples.insert(samples.end(), l->begin(), l->end());
+        l->clear();
+    }
+    if (samples.empty()) {
+        std::printf("  latency    %u thr: no samples\n", threads);
+        return;
+    }
+    std::sort(samples.begin(), samples.end());
+    const auto pct = [](const double p) { return samples[static_cast<size_t>(p * (samples.size() - 1u))] / 1000.0; };
+    std::printf("  latency    %u thr: %zu cb, p50 %.1f us, p99 %.1f us, max %.1f us\n",
+                threads, samples.size(), pct(0.5), pct(0.99), samples.back() / 1000.0);
+}
+
+int main()
+{
+    std::printf("HostTimerServiceBench: %u timers, %u hardware threads\n",
+                timers, std::thread::hardware_concurrency());
+    for (const unsigned n : {1u, 2u, 4u, 8u}) {
+        std::printf("  throughput %u thr: %.2f M cb/s\n", n, throughput(n) / 1e6);
+    }
+    for (const unsigned n : {1u, 2u, 4u, 8u}) {
+        latency(n);
+    }
+    return 0;
+}
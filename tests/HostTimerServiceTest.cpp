@@ -0,0 +1,206 @@
+/*
+ * HostTimerServiceTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * HostTimerService: one-shot, periodic, cancel, cancelSync of a running
+ * callback, self-destruction from the callback, destroying timers that
+ * re-arm themselves or still have stale entries queued, slot exhaustion. Add -fsanitize=address to
+ * catch use-after-free in the destroy cases.
+ */
+
+#include "time/HostTimerService.h"
+#include "time/tests/test_common.h"
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using Service = HostTimerService<>;
+using namespace std::chrono_literals;
+
+static constexpr u64 us = 1'000ull;
+static constexpr u64 ms = 1'000'000ull;
+
+static bool waitFor(bool (*cond)(void*), void* arg, const std::chrono::milliseconds limit = 2000ms)
+{
+    const auto end = std::chrono::steady_clock::now() + limit;
+    while (!cond(arg)) {
+        if (std::chrono::steady_clock::now() > end) {
+            return false;
+        }
+        std::this_thread::sleep_for(100us);
+    }
+    return true;
+}
+
+static bool firedOnce(void* t) { return static_cast<HostTimer*>(t)->fired() >= 1u; }
+static bool firedFive(void* t) { return static_cast<HostTimer*>(t)->fired() >= 5u; }
+
+static void basic(Service& svc)
+{
+    HostTimer one;
+    CHECK(svc.arm(one, 1 * ms));
+    CHECK(one.isArmed());
+    CHECK(waitFor(firedOnce, &one));
+    std::this_thread::sleep_for(5ms);
+    CHECK_EQ(one.fired(), 1u);
+    CHECK(!one.isArmed());
+    CHECK(!svc.cancelSync(one));        // already fired
+
+    HostTimer per;
+    CHECK(svc.arm(per, 0, 1 * ms));
+    CHECK(waitFor(firedFive, &per));
+    CHECK(svc.cancelSync(per));
+    const u64 n = per.fired();
+    std::this_thread::sleep_for(10ms);
+    CHECK_EQ(per.fired(), n);           // stopped exactly
+
+    HostTimer never;
+    CHECK(svc.arm(never, 20 * ms));
+    CHECK(svc.cancel(never));
+    std::this_thread::sleep_for(40ms);
+    CHECK_EQ(never.fired(), 0u);
+    svc.cancelSync(never);
+}
+
+static std::atomic<bool> inside{false};
+static std::atomic<bool> leave{false};
+
+static void slowCallback(HostTimer&)
+{
+    inside.store(true);
+    while (!leave.load()) {
+        std::this_thread::yield();
+    }
+}
+
+static void cancelSyncWaits(Service& svc)
+{
+    HostTimer t(slowCallback);
+    inside = false;
+    leave  = false;
+    svc.arm(t, 0);
+    while (!inside.load()) {
+        std::this_thread::yield();
+    }
+    std::atomic<bool> done{false};
+    std::thread canceller([&] {
+        svc.cancelSync(t);
+        done = true;
+    });
+    std::this_thread::sleep_for(20ms);
+    CHECK(!done.load());                // callback still running
+    leave = true;
+    canceller.join();
+    CHECK(done.load());
+}
+
+static Service*         selfSvc = nullptr;
+static std::atomic<u32> selfDeleted{0};
+
+static void deleteSelf(HostTimer& t)
+{
+    selfSvc->cancelSync(t);
+    delete &t;
+    selfDeleted.fetch_add(1u);
+}
+
+static void destroyFromCallback(Service& svc)
+{
+    selfSvc = &svc;
+    for (u32 i = 0; i < 200; ++i) {
+        HostTimer* t = new HostTimer(deleteSelf);
+        svc.arm(*t, 0, 200 * us);       // periodic: the re-arm must not touch the deleted timer
+    }
+    const auto end = std::chrono::steady_clock::now() + 2s;
+    while (selfDeleted.load() < 200u && std::chrono::steady_clock::now() < end) {
+        std::this_thread::sleep_for(1ms);
+    }
+    CHECK_EQ(selfDeleted.load(), 200u);
+}
+
+static Service* rearmSvc = nullptr;
+
+static void rearmSelf(HostTimer& t)
+{
+    rearmSvc->arm(t, 0);
+}
+
+static void destroyRearming(Service& svc)
+{
+    // callbacks re-arm their own timer while another thread cancelSyncs it
+    rearmSvc = &svc;
+    for (u32 round = 0; round < 50; ++round) {
+        std::vector<HostTimer*> ts;
+        for (u32 i = 0; i < 20; ++i) {
+            ts.push_back(new HostTimer(rearmSelf));
+            svc.arm(*ts.back(), 0);
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(200u + round * 10u));
+        for (HostTimer* t : ts) {
+            svc.cancelSync(*t);
+            CHECK(!t->isArmed());
+            delete t;
+        }
+    }
+}
+
+static void destroyWithStaleEntries(Service& svc)
+{
+    // every re-arm leaves the previous request queued; after cancelSync the
+    // timer is gone while its entries come due
+    for (u32 round = 0; round < 2000; ++round) {
+        HostTimer* t = new HostTimer;
+        for (u32 k = 0; k < 4; ++k) {
+            svc.arm(*t, (k + 1u) * 50 * us, (k & 1u) ? 100 * us : 0u);
+        }
+        if (round & 1u) {
+            std::this_thread::sleep_for(std::chrono::microseconds(round % 300u));
+        }
+        svc.cancelSync(*t);
+        delete t;
+    }
+    std::this_thread::sleep_for(20ms);  // let every stale entry come up
+    CHECK(svc.stats().stale > 0u);
+}
+
+static void slotExhaustion()
+{
+    Service svc(1, 1u << 6, 1u << 6, 2);
+    svc.start();
+    HostTimer a, b, c;
+    CHECK(svc.arm(a, 10 * ms));
+    CHECK(svc.arm(b, 10 * ms));
+    CHECK(!svc.arm(c, 10 * ms));        // both slots bound
+    CHECK(svc.arm(a, 10 * ms));         // re-arm keeps its slot
+    svc.cancelSync(a);
+    CHECK(svc.arm(c, 1 * ms));
+    CHECK(waitFor(firedOnce, &c));
+    CHECK_EQ(a.fired(), 0u);
+    svc.cancelSync(b);
+    svc.cancelSync(c);
+
+    Service other(1);
+    CHECK(other.arm(b, 20 * ms));       // unbound after cancelSync: free to move
+    other.cancelSync(b);
+    HostTimer d;
+    CHECK(svc.arm(d, 10 * ms));
+    CHECK(!other.arm(d, 0));            // bound to svc
+    CHECK(!other.cancel(d));
+    svc.cancelSync(d);
+}
+
+int main()
+{
+    Service svc(2);
+    svc.start();
+    basic(svc);
+    cancelSyncWaits(svc);
+    destroyFromCallback(svc);
+    destroyRearming(svc);
+    destroyWithStaleEntries(svc);
+    svc.stop();
+    slotExhaustion();
+    return test_result("HostTimerServiceTest");
+}
@@ -0,0 +1,62 @@
+/*
+ * LinuxClockBench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Per-call cost and smallest observed step of Monotonic, MonotonicRaw and
+ * Tsc (Tsc steps converted to ns with its calibrated rate)
+ *
+ * Sources: LinuxClock.cpp
+ */
+
+#include "time/LinuxClock.h"
+#include <chrono>
+#include <cstdio>
+#include <limits>
+
+template<class Clock>
+static void measure(const char* const name, const u32 n)
+{
+    if (!Clock::isAvailable()) {
+        std::printf("  %-12s not available\n", name);
+        return;
+    }
+    const double hz = static_cast<double>(Clock::ticksPerSecond());   // Tsc: calibrates here
+
+    // cost: back-to-back reads
+    volatile u64 sink = 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (u32 i = 0; i < n; ++i) {
+        sink = sink + Clock::now();
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+    const double cost = std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+
+    // resolution: smallest non-zero step between consecutive reads
+    u64 step = std::numeric_limits<u64>::max();
+    u64 prev = Clock::now();
+    for (u32 i = 0; i < n; ++i) {
+        const u64 t = Clock::now();
+        if (t != prev && t - prev < step) {
+            step = t - prev;
+        }
+        prev = t;
+    }
+
+    std::printf("  %-12s %6.1f ns/call, smallest step %6.1f ns\n",
+                name, cost, static_cast<double>(step) * 1e9 / hz);
+}
+
+int main()
+{
+    constexpr u32 n = 2'000'000;
+    std::printf("LinuxClockBench: %u calls each\n", n);
+    measure<Monotonic>("Monotonic", n);
+    measure<MonotonicRaw>("MonotonicRaw", n);
+#ifdef TSC_TIME_IS_EXISTS
+    measure<Tsc>("Tsc", n);
+    std::printf("  Tsc rate     %llu Hz\n", static_cast<unsigned long long>(Tsc::ticksPerSecond()));
+#endif
+    return 0;
+}
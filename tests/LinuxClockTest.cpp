@@ -0,0 +1,93 @@
+/*
+ * LinuxClockTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Linux clocks: monotonicity, Tsc calibration against CLOCK_MONOTONIC_RAW,
+ * the split 64-bit mul-div used for tick conversions
+ *
+ * Sources: LinuxClock.cpp
+ */
+
+#include "time/LinuxClock.h"
+#include "time/tests/test_common.h"
+
+static void mulDiv()
+{
+    // reference: long multiplication in 32-bit halves, no 128-bit type
+    auto ref = [](const u64 a, const u64 b, const u64 c, const u64 round) {
+        // (a * b + round) / c by shift-and-subtract over a 128-bit pair
+        const u64 al = a & 0xFFFFFFFFu, ah = a >> 32, bl = b & 0xFFFFFFFFu, bh = b >> 32;
+        const u64 ll = al * bl, lh = al * bh, hl = ah * bl, hh = ah * bh;
+        const u64 mid = (ll >> 32) + (lh & 0xFFFFFFFFu) + (hl & 0xFFFFFFFFu);
+        u64 lo = (ll & 0xFFFFFFFFu) | (mid << 32);
+        u64 hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+        lo += round;
+        hi += (lo < round) ? 1u : 0u;
+        u64 q = 0, r = 0;
+        for (int i = 127; i >= 0; --i) {
+            const u64 bit = (i >= 64) ? ((hi >> (i - 64)) & 1u) : ((lo >> i) & 1u);
+            const bool carry = (r >> 63) != 0u;
+            r = (r << 1) | bit;
+            q <<= 1;
+            if (carry || r >= c) {
+                r -= c;
+                q |= 1u;
+            }
+        }
+        return q;
+    };
+
+    u64 rng = 1;
+    u32 bad = 0;
+    for (u32 i = 0; i < 200000; ++i) {
+        rng = rng * 6364136223846793005ull + 1442695040888963407ull;
+        const u64 v  = rng >> (rng & 63u);
+        const u64 hz = 1'000'000ull + (rng >> 20) % 5'000'000'000ull;   // up to 5 GHz
+        for (const u64 div : {1'000ull, 1'000'000ull, 1'000'000'000ull}) {
+            if (v / div >= ~u64{0} / hz) {
+                continue;                                                // result beyond u64
+            }
+            if (ref(v, hz, div, div - 1u) != linux_clock_detail::mul_div(v, hz, div, div - 1u)) {
+                ++bad;
+            }
+        }
+    }
+    CHECK_EQ(bad, 0u);
+    // 10 s at 3.5 GHz: overflows a plain u64 product
+    CHECK_EQ(linux_clock_detail::mul_div(10'000'000'000ull, 3'500'000'000ull, 1'000'000'000ull, 999'999'999ull),
+             35'000'000'000ull);
+}
+
+static void clocks()
+{
+    CHECK(Monotonic::isAvailable());
+    u64 prev = Monotonic::now();
+    for (u32 i = 0; i < 100000; ++i) {
+        const u64 t = Monotonic::now();
+        CHECK(t >= prev);
+        prev = t;
+    }
+#if defined(TSC_TIME_IS_EXISTS)
+    if (Tsc::isAvailable()) {
+        const u64 hz = Tsc::ticksPerSecond();
+        CHECK(hz > 100'000'000ull && hz < 10'000'000'000ull);
+        const u64 t0 = Tsc::now();
+        const u64 n0 = MonotonicRaw::now();
+        while (MonotonicRaw::now() - n0 < 50'000'000ull) {
+        }
+        const u64 ticks = Tsc::now() - t0;
+        const u64 want  = TscBuilder::from_milli(50);
+        CHECK(ticks > want * 98u / 100u && ticks < want * 102u / 100u);
+        std::printf("Tsc: %llu Hz\n", static_cast<unsigned long long>(hz));
+    }
+#endif
+}
+
+int main()
+{
+    mulDiv();
+    clocks();
+    return test_result("LinuxClockTest");
+}
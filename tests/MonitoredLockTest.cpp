@@ -0,0 +1,60 @@
+/*
+ * MonitoredLockTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * MonitoredLock: the longest section reports the file/line of the guard's
+ * statement, of TIME_MONITORED_LOCK() and of the time_tick_locked() caller
+ *
+ * Flags: -DTIME_CPU_MONITOR=1 -DTIME_CPU_MONITOR_LOCKS=1
+ */
+
+#include "time/lock_policy.h"
+#include "time/tests/test_common.h"
+#include <cstring>
+#include <thread>
+
+static void hold()
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+}
+
+static bool fromThisFile()
+{
+    const char* const file = CpuMonitor::longestSection().file;
+    return file != nullptr && std::strstr(file, "MonitoredLockTest.cpp") != nullptr;
+}
+
+int main()
+{
+    CpuMonitor::isAvailable();
+
+    CpuMonitor::reset();
+    u32 guardLine = 0;
+    {
+        MonitoredLock<NoLock> guard; guardLine = __LINE__;
+        hold();
+    }
+    CHECK(fromThisFile());
+    CHECK_EQ(CpuMonitor::longestSection().line, guardLine);
+
+    CpuMonitor::reset();
+    u32 macroLine = 0;
+    {
+        TIME_MONITORED_LOCK(NoLock); macroLine = __LINE__;
+        hold();
+    }
+    CHECK(fromThisFile());
+    CHECK_EQ(CpuMonitor::longestSection().line, macroLine);
+
+    CpuMonitor::reset();
+    u32 tickLine = 0;
+    time_tick_locked([] { hold(); }); tickLine = __LINE__;
+    if (lock_traits<TimeLock>::tick_needs_lock) {
+        CHECK(fromThisFile());                  // not lock_policy.h
+        CHECK_EQ(CpuMonitor::longestSection().line, tickLine);
+    }
+
+    return test_result("MonitoredLockTest");
+}
@@ -0,0 +1,97 @@
+/*
+ * OneShotVTimerTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * OneShotVTimer with its state in the stamp: fires once after start(),
+ * not before start(), re-arms on next(), stop() disarms, elapsed() and
+ * interval unaffected by the state bits, same size as the periodic timer
+ */
+
+#include "time/virtual.h"
+#include "time/tests/test_common.h"
+
+struct TestDomain {};
+using Ticks = BasicVTimer<TestDomain>;
+
+template<auto Interval = 0u>
+using OneShot  = OneShotVDomain<TestDomain, Interval>;
+template<auto Interval = 0u>
+using Periodic = DomainVTimer<TestDomain, Interval>;
+
+static_assert(sizeof(OneShot<100u>) == sizeof(Periodic<100u>), "state bits live in the stamp");
+static_assert(sizeof(OneShot<>) == sizeof(Periodic<>), "state bits live in the stamp");
+
+static void tick(const u32 n)
+{
+    for (u32 i = 0; i < n; ++i) {
+        Ticks::tick();
+    }
+}
+
+static void lifecycle()
+{
+    OneShot<5u> t;
+    tick(10);
+    CHECK(!t.isExpired());                      // never started
+    CHECK(t.isStopped());
+
+    t.start();
+    CHECK(!t.isStopped());
+    tick(4);
+    CHECK(!t.isExpired());
+    CHECK_EQ(t.elapsed(), 4u);
+    tick(1);
+    CHECK(t.isExpired());
+    CHECK(!t.isExpired());                      // latched
+    tick(10);
+    CHECK(!t.isExpired());
+
+    t.next();                                   // re-arm, still started
+    tick(5);
+    CHECK(t.isExpired());
+
+    t.start();
+    tick(2);
+    t.stop();
+    tick(10);
+    CHECK(!t.isExpired());
+    CHECK(t.isStopped());
+    t.next();                                   // next() does not start a stopped timer
+    tick(10);
+    CHECK(!t.isExpired());
+}
+
+static void dynamic()
+{
+    OneShot<> t(3);
+    t.start(7u);
+    CHECK_EQ(t.getInterval(), 7u);
+    tick(6);
+    CHECK(!t.isExpired());
+    tick(1);
+    CHECK(t.isExpired());
+    t.start();
+    tick(7);
+    CHECK(t.isExpired());
+
+    // elapsed() across the domain clock wrap, state bits masked out
+    while (Ticks::ticks() != 0xFFFF'FFF0u) {
+        const u32 left = 0xFFFF'FFF0u - Ticks::ticks();
+        Ticks::advance(left > 0x1000'0000u ? 0x1000'0000u : left);
+    }
+    t.start(40u);
+    tick(0x20);
+    CHECK_EQ(t.elapsed(), 0x20u);
+    CHECK(!t.isExpired());
+    tick(8);
+    CHECK(t.isExpired());
+}
+
+int main()
+{
+    lifecycle();
+    dynamic();
+    return test_result("OneShotVTimerTest");
+}
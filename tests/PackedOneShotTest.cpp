@@ -0,0 +1,84 @@
+/*
+ * PackedOneShotTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * PackedOneShotITimer: wrap-around of the clock and of the packed time field,
+ * interval saturation reporting
+ */
+
+#include "time/interval/PackedOneShotITimer.h"
+#include "time/tests/test_common.h"
+
+template<PackedStore Store>
+static void wrapClock(const char* name)
+{
+    // u16 storage (14-bit time field) against a u32 clock crossing 2^32
+    PackedOneShotITimer<0u, u32, u16, Store> t(100);
+    u32 now = 0xFFFFFFFFu - 40u;
+    t.start(now);
+    u32 fired = 0;
+    u32 at    = 0;
+    for (u32 i = 0; i < 200; ++i, ++now) {
+        if (t.isExpired(now)) {
+            ++fired;
+            at = i;
+        }
+    }
+    if (fired != 1u || at != 100u) {
+        std::printf("%s: fired %u at +%u\n", name, fired, at);
+    }
+    CHECK_EQ(fired, 1u);
+    CHECK_EQ(at, 100u);
+}
+
+template<PackedStore Store>
+static void wrapField()
+{
+    // many periods, each crossing the 2^14 field boundary at a different phase
+    PackedOneShotITimer<0u, u32, u16, Store> t(3000);
+    u32 now = 0x12340000u;
+    for (u32 round = 0; round < 50; ++round) {
+        t.start(now);
+        u32 n = 0;
+        while (!t.isExpired(now)) {
+            ++now;
+            ++n;
+        }
+        CHECK_EQ(n, 3000u);
+        CHECK(!t.isExpired(now));   // latched: true only once
+        now += 7u;
+    }
+}
+
+static void saturation()
+{
+    using Lt = PackedOneShotITimer<0u, u32, u16>;
+    using Dl = PackedOneShotITimer<0u, u32, u16, PackedStore::Deadline>;
+    CHECK_EQ(Lt::max_interval, 0x3FFFu);
+    CHECK_EQ(Dl::max_interval, 0x2000u);
+    CHECK(Lt::fits(0x3FFFu));
+    CHECK(!Lt::fits(0x4000u));
+
+    Lt t;
+    CHECK(t.start(0, 0x3FFFu));
+    CHECK(!t.start(0, 0x4000u));          // saturated: reported
+    CHECK_EQ(t.getInterval(), 0x3FFFu);
+    CHECK(!t.next(0, 100000u));
+
+    Dl d;
+    CHECK(d.start(0, 0x2000u));
+    CHECK(!d.start(0, 0x2001u));
+    CHECK_EQ(d.getInterval(), 0x2000u);
+}
+
+int main()
+{
+    wrapClock<PackedStore::LastTime>("LastTime");
+    wrapClock<PackedStore::Deadline>("Deadline");
+    wrapField<PackedStore::LastTime>();
+    wrapField<PackedStore::Deadline>();
+    saturation();
+    return test_result("PackedOneShotTest");
+}
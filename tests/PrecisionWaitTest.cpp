@@ -0,0 +1,185 @@
+/*
+ * PrecisionWaitTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * PrecisionWait on a simulated timeline: Fine::now() advances a few ticks per
+ * read, Sleep::sleep() jumps to the next Coarse edge plus a scripted wake-up
+ * lateness. Covers a late wake growing the margin, decay towards minMargin,
+ * an overshot coarse phase, a wait shorter than one tick only spinning, and
+ * the PrecisionWaitStats bucket/percentile math
+ */
+
+#include "time/PrecisionWait.h"
+#include "time/tests/test_common.h"
+
+static constexpr u32 tickLen = 1000;   // Fine ticks per Coarse tick
+
+struct Timeline {
+    static inline u32 t      = 0;
+    static inline u32 step   = 1;      // Fine ticks per Fine::now() read
+    static inline u32 sleeps = 0;
+    static inline const u32* late = nullptr;   // lateness of the next wakes, then 0
+    static inline u32 lateLeft = 0;
+
+    static void reset(const u32 at = 0) {
+        t = at;
+        step = 1;
+        sleeps = 0;
+        late = nullptr;
+        lateLeft = 0;
+    }
+};
+
+struct MockFine {
+    using type_t = u32;
+    static u32 now() noexcept { Timeline::t += Timeline::step; return Timeline::t; }
+};
+
+struct MockCoarse {
+    using type_t = u32;
+    static u32 now() noexcept { return Timeline::t / tickLen; }
+};
+
+struct MockSleep {
+    static void sleep() noexcept {
+        ++Timeline::sleeps;
+        u32 l = 0;
+        if (Timeline::lateLeft != 0u) {
+            l = *Timeline::late++;
+            --Timeline::lateLeft;
+        }
+        Timeline::t = (Timeline::t / tickLen + 1u) * tickLen + l;
+    }
+};
+
+using Wait = PrecisionWait<MockCoarse, MockFine, MockSleep>;
+
+template<u32 K>
+static void script(const u32 (&l)[K])
+{
+    Timeline::late     = l;
+    Timeline::lateLeft = K;
+}
+
+static void lateWakeGrowsMargin()
+{
+    Timeline::reset();
+    Wait w(tickLen, 10);
+    static const u32 l[] = {0, 300};
+    script(l);
+
+    // wakes at 1000 and 2300 (300 late): jitter 300 -> margin 300 + 25%
+    CHECK_EQ(w.until(2500), 0u);
+    CHECK_EQ(Timeline::sleeps, 2u);
+    CHECK_EQ(w.margin(), 375u);
+    CHECK_EQ(w.stats().overrun, 0u);
+    CHECK_EQ(w.stats().slept, 2301u - 1u);      // first read to the read after the late wake
+    CHECK_EQ(w.stats().spun, 2500u - 2301u);
+}
+
+static void decay()
+{
+    Timeline::reset();
+    Wait w(tickLen, 10);
+    static const u32 l[] = {0, 300};
+    script(l);
+    (void)w.until(2500);
+    CHECK_EQ(w.margin(), 375u);
+
+    // on-time wakes: each aligned one takes 1/16 of the excess off
+    u32 prev = w.margin();
+    for (u32 i = 0; i < 20; ++i) {
+        CHECK_EQ(w.wait(10 * tickLen), 0u);
+        CHECK(w.margin() <= prev);
+        prev = w.margin();
+    }
+    CHECK(w.margin() >= 10u);
+    CHECK(w.margin() < 10u + 16u);              // stops within 1/16 resolution of the floor
+    CHECK_EQ(w.stats().overrun, 0u);
+
+    // first decay step exactly: 375 - (375 - 10) / 16
+    Wait v(tickLen, 10);
+    Timeline::reset(5000);
+    script(l);
+    (void)v.until(7500);                        // margin 375, t = 7500
+    static const u32 none[] = {0};
+    script(none);
+    Timeline::t = 7999;
+    (void)v.until(11'000 + 377);                // wakes at 9000, then 10000 and 11000 on time
+    CHECK_EQ(v.margin(), 375u - 22u - 21u);     // one step per aligned wake
+}
+
+static void overshoot()
+{
+    Timeline::reset();
+    Wait w(tickLen, 10);
+    static const u32 l[] = {0, 900};
+    script(l);
+
+    // second wake at 2900: past the 2500 deadline
+    CHECK_EQ(w.until(2500), 401u);              // read after the wake at 2900
+    CHECK_EQ(w.stats().overrun, 1u);
+    CHECK(w.margin() > 900u);                   // the jitter seen, then the overshoot
+    CHECK_EQ(w.stats().max, 401u);
+}
+
+static void shortWaitOnlySpins()
+{
+    Timeline::reset(123);
+    Wait w(tickLen, 10);
+    CHECK_EQ(w.wait(500), 0u);
+    CHECK_EQ(Timeline::sleeps, 0u);
+    CHECK_EQ(w.stats().slept, 0u);
+    CHECK_EQ(w.stats().spun, 500u - 1u);        // from the read in until(), one after wait()'s
+
+    // one tick plus the margin does not fit: still no sleep
+    CHECK_EQ(w.wait(tickLen + 10), 0u);
+    CHECK_EQ(Timeline::sleeps, 0u);
+    CHECK_EQ(w.margin(), 10u);
+}
+
+static void stats()
+{
+    PrecisionWaitStats<u32> s;
+    CHECK_EQ(s.mean(), 0u);
+    CHECK_EQ(s.percentile(990), 0u);
+
+    s.count   = 10;
+    s.sum     = 5 * 0 + 4 * 5 + 600;
+    s.max     = 600;
+    s.log2[0] = 5;                              // error 0
+    s.log2[3] = 4;                              // [4, 8)
+    s.log2[10] = 1;                             // [512, 1024)
+    CHECK_EQ(s.mean(), 62u);
+    CHECK_EQ(s.percentile(500), 0u);
+    CHECK_EQ(s.percentile(501), 7u);            // rounds the needed count up
+    CHECK_EQ(s.percentile(900), 7u);
+    CHECK_EQ(s.percentile(1000), 1023u);
+
+    // bucket of a recorded wait: 7 Fine ticks per read, 500-tick spin ends 4 late
+    Timeline::reset();
+    Timeline::step = 7;
+    Wait w(tickLen);
+    CHECK_EQ(w.wait(500), 4u);
+    CHECK_EQ(w.stats().log2[3], 1u);
+    CHECK_EQ(w.stats().percentile(1000), 7u);
+    Timeline::step = 1;
+    CHECK_EQ(w.wait(100), 0u);
+    CHECK_EQ(w.stats().log2[0], 1u);
+    CHECK_EQ(w.stats().count, 2u);
+    CHECK_EQ(w.stats().mean(), 2u);
+    w.resetStats();
+    CHECK_EQ(w.stats().count, 0u);
+}
+
+int main()
+{
+    lateWakeGrowsMargin();
+    decay();
+    overshoot();
+    shortWaitOnlySpins();
+    stats();
+    return test_result("PrecisionWaitTest");
+}
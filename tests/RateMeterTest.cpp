@@ -0,0 +1,131 @@
+/*
+ * RateMeterTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * RateMeter: window sum and rate, old buckets retired, EWMA convergence and
+ * decay, an ewma() read at an older epoch changes nothing, concurrent add()
+ * loses no events (add -fsanitize=thread)
+ */
+
+#include "time/RateMeter.h"
+#include "time/tests/test_common.h"
+#include <thread>
+#include <vector>
+
+template<typename T>
+struct ManualClock
+{
+    using type_t = T;
+    static inline std::atomic<type_t> t{0};
+    static type_t now() noexcept { return t.load(std::memory_order_relaxed); }
+};
+
+using Clock16 = ManualClock<u16>;
+using Clock32 = ManualClock<u32>;
+
+static void window()
+{
+    Clock32::t = 1000;
+    RateMeter<Clock32, 8> m(4);                 // 8 x 4 ticks
+    CHECK_EQ(m.bucketTicks(), 4u);
+    CHECK_EQ(m.windowTicks(), 32u);
+    CHECK_EQ(m.sum(), 0u);
+
+    for (u32 t = 1000; t < 1040; ++t) {         // one event per tick
+        Clock32::t = t;
+        m.add();
+    }
+    // bucket 1036..1039 complete + 7 before it
+    CHECK_EQ(m.sum(), 32u);
+    CHECK_EQ(m.rate(32), 32u);
+
+    Clock32::t = 1044;                          // one bucket later, nothing added
+    CHECK_EQ(m.sum(), 24u);                     // 1016..1039
+    Clock32::t = 1044 + 32;                     // whole window idle
+    CHECK_EQ(m.sum(), 0u);
+    Clock32::t = 1044 + 4000;                   // long idle: 8-bit tags alias
+    m.add(5);
+    CHECK_EQ(m.sum(), 5u);
+
+    // idle for exactly 256 epochs with a full window: every slot's old tag
+    // equals its new one and must still be retired
+    for (u32 k = 0; k < 32u; ++k) {
+        Clock32::t = 6000 + k;
+        m.add();
+    }
+    CHECK_EQ(m.sum(), 32u);
+    Clock32::t = 6031 + 256u * 4u;
+    CHECK_EQ(m.sum(), 0u);
+    m.add(3);
+    CHECK_EQ(m.sum(), 3u);
+
+    // 200 idle epochs, no alias: retired by the old-tag rule
+    Clock32::t = 9000 + 200u * 4u;
+    m.add(7);
+    CHECK_EQ(m.sum(), 7u);
+}
+
+static void ewma()
+{
+    Clock16::t = 0;
+    RateMeter<Clock16, 8> m(1, 3);
+    u16 t = 0;
+    for (u32 i = 0; i < 0x1'2000u; ++i) {       // 16 events per bucket, clock wraps
+        Clock16::t = ++t;
+        m.add(16);
+        (void)m.ewma();
+    }
+    const u32 steady = m.ewma();
+    CHECK(steady > (16u << 8) - 8u && steady <= (16u << 8));
+    CHECK_EQ(m.ewmaRate(256), steady);          // 1-tick buckets: Q8 per 256 ticks
+
+    // a read at an older epoch (clock sampled before the last fold) folds nothing
+    Clock16::t = static_cast<u16>(t - 1u);
+    CHECK_EQ(m.ewma(), steady);
+    Clock16::t = t;
+    CHECK_EQ(m.ewma(), steady);                 // and nothing is folded twice later
+
+    // bucket t filled, then three empty ones
+    Clock16::t = static_cast<u16>(t + 4u);
+    u64 expect = steady;
+    for (u32 i = 0; i < 4; ++i) {
+        const i64 c = (i == 0) ? (16 << 8) : 0; // bucket t was filled
+        expect = static_cast<u64>(static_cast<i64>(expect) + (c - static_cast<i64>(expect)) / 8);
+    }
+    m.add(0);
+    CHECK_EQ(m.ewma(), static_cast<u32>(expect));
+
+    // idle longer than the fold limit: decays in bounded work (to below one
+    // 2^-ewmaShift step, where the truncating fold stops)
+    Clock16::t = static_cast<u16>(t + 0x4000u);
+    CHECK(m.ewma() < 8u);
+}
+
+static void contention()
+{
+    Clock32::t = 0;
+    RateMeter<Clock32, 16> m(1u << 20);
+    constexpr u32 perThread = 200'000;
+    std::vector<std::thread> ts;
+    for (u32 i = 0; i < 4; ++i) {
+        ts.emplace_back([&m] {
+            for (u32 k = 0; k < perThread; ++k) {
+                m.add();
+            }
+        });
+    }
+    for (auto& th : ts) {
+        th.join();
+    }
+    CHECK_EQ(m.sum(), 4u * perThread);
+}
+
+int main()
+{
+    window();
+    ewma();
+    contention();
+    return test_result("RateMeterTest");
+}
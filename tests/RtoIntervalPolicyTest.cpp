@@ -0,0 +1,99 @@
+/*
+ * RtoIntervalPolicyTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * RtoIntervalPolicy: RFC 6298 estimate, backoff, setInterval() through the
+ * timer keeps the estimate, reset() drops it
+ */
+
+#include "time/interval/OneShotIBase.h"
+#include "time/tests/test_common.h"
+
+struct ManualClock
+{
+    using type_t = u32;
+    static inline type_t t = 0;
+    static type_t now() noexcept { return t; }
+};
+
+using Rto   = RtoIntervalPolicy<u32, 1000, 100, 8000>;
+using Retry = OneShotIBase<0u, ManualClock, Rto>;
+
+static void estimate()
+{
+    Rto rto;
+    CHECK_EQ(rto.getInterval(), 1000u);
+    rto.onRttSample(200);                   // SRTT 200, RTTVAR 100 -> 600
+    CHECK_EQ(rto.srtt(), 200u);
+    CHECK_EQ(rto.rttvar(), 100u);
+    CHECK_EQ(rto.getInterval(), 600u);
+    rto.onRttSample(200);                   // RTTVAR 75 -> 500
+    CHECK_EQ(rto.getInterval(), 500u);
+
+    rto.backoff();
+    rto.backoff();
+    CHECK_EQ(rto.getInterval(), 2000u);
+    for (u32 i = 0; i < 8; ++i) {
+        rto.backoff();
+    }
+    CHECK_EQ(rto.getInterval(), 8000u);     // capped
+    rto.resetBackoff();
+    CHECK_EQ(rto.getInterval(), 500u);
+}
+
+static void setIntervalKeepsEstimate()
+{
+    Rto rto;
+    rto.onRttSample(200);
+    rto.onRttSample(200);
+    rto.setInterval(300);
+    CHECK_EQ(rto.getInterval(), 300u);
+    CHECK_EQ(rto.srtt(), 200u);
+    CHECK_EQ(rto.rttvar(), 75u);
+    rto.setInterval(10);                    // clamped to MinRto
+    CHECK_EQ(rto.getInterval(), 100u);
+
+    rto.backoff();                          // backoff applies on top of an override
+    rto.setInterval(300);
+    CHECK_EQ(rto.getInterval(), 600u);
+    CHECK_EQ(rto.backoffs(), 1u);
+
+    rto.onRttSample(200);                   // the estimate takes over again
+    CHECK_EQ(rto.srtt(), 200u);
+    CHECK_EQ(rto.backoffs(), 0u);
+
+    rto.reset();
+    CHECK_EQ(rto.srtt(), 0u);
+    CHECK_EQ(rto.rttvar(), 0u);
+    CHECK_EQ(rto.getInterval(), 1000u);
+    rto.reset(400);
+    CHECK_EQ(rto.getInterval(), 400u);
+}
+
+static void throughTimer()
+{
+    ManualClock::t = 0;
+    Retry retry;
+    retry.start();
+    ManualClock::t = 120;
+    retry.onRttSample(retry.elapsed());
+    CHECK_EQ(retry.srtt(), 120u);
+
+    retry.start(250u);                      // generic start(interval) path
+    CHECK_EQ(retry.getInterval(), 250u);
+    CHECK_EQ(retry.srtt(), 120u);
+    ManualClock::t = 120 + 249;
+    CHECK(!retry.isExpired());
+    ManualClock::t = 120 + 250;
+    CHECK(retry.isExpired());
+}
+
+int main()
+{
+    estimate();
+    setIntervalKeepsEstimate();
+    throughTimer();
+    return test_result("RtoIntervalPolicyTest");
+}
@@ -0,0 +1,131 @@
+/*
+ * SeqITimerTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * SeqITimer torn reads: every snapshot must be a (lastTime, interval) pair
+ * the writer published together. Readers run on other threads and in a
+ * signal handler that preempts the writer mid-publish (the ISR case: the
+ * reader must not wait for the writer it interrupted).
+ */
+
+#include "time/interval/SeqITimer.h"
+#include "time/tests/test_common.h"
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <thread>
+#include <vector>
+#include <sys/time.h>
+
+// interval derived from lastTime: a mixed pair is detected by the check
+template<typename T>
+static constexpr T pairOf(const T last) noexcept
+{
+    return static_cast<T>(~last ^ (last >> 7));
+}
+
+// both halves of a u64 change on every publish
+template<typename T>
+static constexpr T valueAt(const u64 k) noexcept
+{
+    return static_cast<T>(k * 0x0000'0001'0000'0001ull + 0x1234u);
+}
+
+template<typename T>
+static void threads(const char* const name)
+{
+    SeqITimer<0u, T> timer(pairOf<T>(valueAt<T>(0)));
+    timer.next(valueAt<T>(0), pairOf<T>(valueAt<T>(0)));
+
+    std::atomic<bool> stop{false};
+    std::atomic<u64>  reads{0};
+    std::atomic<u64>  torn{0};
+
+    std::vector<std::thread> readers;
+    for (u32 r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            u64 n = 0;
+            u64 bad = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                const auto s = timer.snapshot();
+                bad += (s.interval != pairOf<T>(s.lastTime)) ? 1u : 0u;
+                ++n;
+            }
+            reads += n;
+            torn += bad;
+        });
+    }
+
+    const auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(300);
+    u64 k = 1;
+    while (std::chrono::steady_clock::now() < end) {
+        for (u32 i = 0; i < 1000u; ++i, ++k) {
+            const T last = valueAt<T>(k);
+            timer.next(last, pairOf<T>(last));
+        }
+    }
+    stop = true;
+    for (auto& t : readers) {
+        t.join();
+    }
+    std::printf("  %s threads: %llu publishes, %llu reads\n", name,
+                static_cast<unsigned long long>(k), static_cast<unsigned long long>(reads.load()));
+    CHECK(reads.load() > 0u);
+    CHECK_EQ(torn.load(), 0u);
+}
+
+// signal handler as the ISR
+static SeqITimer<0u, u64>* isrTimer = nullptr;
+static std::atomic<u64>     isrReads{0};
+static std::atomic<u64>     isrTorn{0};
+
+static void isrReader(int)
+{
+    const auto s = isrTimer->snapshot();
+    if (s.interval != pairOf<u64>(s.lastTime)) {
+        isrTorn.fetch_add(1u, std::memory_order_relaxed);
+    }
+    isrReads.fetch_add(1u, std::memory_order_relaxed);
+}
+
+static void preemptedWriter()
+{
+    SeqITimer<0u, u64> timer(pairOf<u64>(valueAt<u64>(0)));
+    timer.next(valueAt<u64>(0), pairOf<u64>(valueAt<u64>(0)));
+    isrTimer = &timer;
+
+    struct sigaction sa {};
+    sa.sa_handler = isrReader;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGALRM, &sa, nullptr);
+    itimerval it {};
+    it.it_interval.tv_usec = 50;
+    it.it_value.tv_usec    = 50;
+    setitimer(ITIMER_REAL, &it, nullptr);
+
+    const auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(300);
+    u64 k = 1;
+    while (std::chrono::steady_clock::now() < end) {
+        for (u32 i = 0; i < 1000u; ++i, ++k) {
+            const u64 last = valueAt<u64>(k);
+            timer.next(last, pairOf<u64>(last));
+        }
+    }
+
+    it = itimerval{};
+    setitimer(ITIMER_REAL, &it, nullptr);
+    signal(SIGALRM, SIG_DFL);
+    std::printf("  signal reader: %llu reads\n", static_cast<unsigned long long>(isrReads.load()));
+    CHECK(isrReads.load() > 0u);
+    CHECK_EQ(isrTorn.load(), 0u);
+}
+
+int main()
+{
+    threads<u32>("u32");
+    threads<u64>("u64");
+    preemptedWriter();
+    return test_result("SeqITimerTest");
+}
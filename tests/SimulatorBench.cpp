@@ -0,0 +1,63 @@
+/*
+ * SimulatorBench.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Simulator throughput: simulated board-seconds per wall-clock second for
+ * a README-style board (10 ms AutoVTimer control loop, 20 ms polled
+ * timeout, 1 kHz UART-like event), then the same run over 1/2/4/8 threads.
+ * Prints figures, always exits 0.
+ *
+ * Sources: Simulator.cpp virtual/VTimer.cpp virtual/AutoVTimer.cpp
+ * Flags: -DTIME_SIM_BUILD
+ */
+
+#include "time/Simulator.h"
+#include <cstdio>
+
+static constexpr u32 boards   = 256;
+static constexpr u64 duration = 10'000'000ull;   // 10 s per board at 1 MHz
+
+struct Board {
+    AutoVTimer  control{10};
+    SimITimer<> rxTimeout{20'000};
+    u32         steps  = 0;
+    u32         faults = 0;
+
+    static void uartIsr(SimBoard& b, void* self) {
+        static_cast<Board*>(self)->rxTimeout.next();
+        b.after(1000, &uartIsr, self);
+    }
+
+    explicit Board(SimBoard& b) { b.after(1234, &uartIsr, this); }
+
+    void loop(SimBoard& b) {
+        while (control.isExpired()) {
+            ++steps;
+        }
+        if (rxTimeout.isExpired()) {
+            ++faults;
+            rxTimeout.next();
+        }
+        b.wakeAt(rxTimeout.deadline());
+    }
+};
+
+static void report(const SimReport& r)
+{
+    std::printf("  %u thr: %.0f sim-s/wall-s, %.1f ms wall, %.2f M loops, %.2f M events, %.2f M SysTicks\n",
+                r.threads, r.simSecondsPerWallSecond(), r.wallNs / 1e6,
+                r.stats.loops / 1e6, r.stats.events / 1e6, r.stats.sysTicks / 1e6);
+}
+
+int main()
+{
+    std::printf("SimulatorBench: %u boards x %.0f s, %u hardware threads\n",
+                boards, duration / 1e6, std::thread::hardware_concurrency());
+    (void)Simulator({}, 1).run<Board>(8, duration);  // warm-up
+    for (const unsigned n : {1u, 2u, 4u, 8u}) {
+        report(Simulator({}, n).run<Board>(boards, duration));
+    }
+    return 0;
+}
@@ -0,0 +1,120 @@
+/*
+ * SimulatorTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Simulator: a board does not inherit domain tick counts or prescaler
+ * phases from the previous board of its thread, so per-board results are
+ * the same for any thread count
+ *
+ * Sources: Simulator.cpp virtual/VTimer.cpp virtual/AutoVTimer.cpp
+ * Flags: -DTIME_SIM_BUILD
+ */
+
+#include "time/Simulator.h"
+#include "time/tests/test_common.h"
+#include <vector>
+
+struct SlowDomain {};
+using Slow      = BasicVTimer<SlowDomain>;
+using SlowClock = DomainTick<SlowDomain>;
+using SlowDiv   = VTimerPrescaler<SlowDomain, 3>;
+
+static void carryOver()
+{
+    {
+        SimBoard a;
+        for (u32 i = 0; i < 5; ++i) {
+            Slow::tick();
+        }
+        SlowDiv::tick();
+        SlowDiv::tick();                        // prescaler phase 2 of 3
+        a.run(50'000, [] {});
+        CHECK_EQ(Slow::ticks(), 5u);
+        CHECK_EQ(VTimer::ticks(), 50u);
+    }
+
+    SimBoard b;
+    CHECK_EQ(Slow::ticks(), 0u);
+    CHECK_EQ(SlowClock::now(), 0u);
+    CHECK_EQ(VTimer::ticks(), 0u);
+    SlowDiv::tick();
+    SlowDiv::tick();
+    CHECK_EQ(Slow::ticks(), 0u);                // phase restarted: no tick yet
+    SlowDiv::tick();
+    CHECK_EQ(Slow::ticks(), 1u);
+
+    b.run(20'000, [] {});
+    CHECK_EQ(VTimer::ticks(), SimTick::now());
+}
+
+// 1 kHz event drives the slow domain through the prescaler
+struct Result {
+    SlowClock::type_t      slowTicks = 0;
+    AutoVTimer::value_type fired     = 0;
+};
+static std::vector<Result> results;
+
+struct Board {
+    AutoVTimer             control{10};
+    Slow                   slow{7};
+    AutoVTimer::value_type fired = 0;
+    SimBoard&              board;
+
+    static void khz(SimBoard& b, void*) {
+        SlowDiv::tick();
+        b.after(1000, &khz);
+    }
+
+    explicit Board(SimBoard& b) : board(b) {
+        b.after(1000u + b.id(), &khz);
+    }
+
+    ~Board() {
+        results[board.id()] = Result{SlowClock::now(), fired};
+    }
+
+    void loop(SimBoard&) {
+        fired += control.expirations();
+        if (slow.isExpired()) {
+            ++fired;
+            slow.next(7);
+        }
+    }
+};
+
+static std::vector<Result> runBoards(const unsigned threads)
+{
+    constexpr u32 boards = 24;
+    results.assign(boards, Result{});
+    const SimReport r = Simulator({}, threads).run<Board>(boards, 100'000);
+    CHECK_EQ(r.boards, boards);
+    CHECK_EQ(r.stats.simTicks, u64{boards} * 100'000u);
+    return results;
+}
+
+static void threadCounts()
+{
+    const auto one = runBoards(1);
+    for (u32 i = 0; i < one.size(); ++i) {
+        CHECK_EQ(one[i].slowTicks, 33u);        // 100 events / 3
+        // control: 9 periods seen by loop() (the one at the end instant is
+        // not), slow timer: expiries at slow ticks 7, 14, 21, 28
+        CHECK_EQ(one[i].fired, 9u + 4u);
+    }
+    for (const unsigned n : {2u, 3u, 5u}) {
+        const auto other = runBoards(n);
+        for (u32 i = 0; i < one.size(); ++i) {
+            CHECK_EQ(other[i].slowTicks, one[i].slowTicks);
+            CHECK_EQ(other[i].fired, one[i].fired);
+        }
+    }
+}
+
+int main()
+{
+    carryOver();
+    threadCounts();
+    return test_result("SimulatorTest");
+}
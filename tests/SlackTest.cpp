@@ -0,0 +1,100 @@
+/*
+ * SlackTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * nextWithSlack(): the aligned expiry applies to one period only, the
+ * configured interval stays; VTimeBase aligns in its own domain ticks;
+ * only SlackITimeBase carries the stretch word
+ */
+
+#include "time/interval/ITimeBase.h"
+#include "time/virtual.h"
+#include "time/tests/test_common.h"
+
+struct ManualClock
+{
+    using type_t = u32;
+    static inline type_t t = 0;
+    static type_t now() noexcept { return t; }
+};
+
+struct TestDomain {};
+using DomainTicks = BasicVTimer<TestDomain>;
+
+static_assert(sizeof(ITimeBase<0u, ManualClock>) == 2 * sizeof(u32), "plain dynamic ITimeBase: stamp + interval");
+static_assert(sizeof(ITimeBase<100u, ManualClock>) == sizeof(u32), "static ITimeBase: stamp");
+static_assert(sizeof(SlackITimeBase<0u, ManualClock>) == 3 * sizeof(u32), "SlackITimeBase: + stretch word");
+static_assert(sizeof(SlackITimeBase<100u, ManualClock>) == sizeof(u32), "static: nothing to stretch");
+
+static void itimer()
+{
+    ManualClock::t = 1000;
+    SlackITimeBase<0u, ManualClock> timer(100);
+
+    timer.nextWithSlack(100, 50);               // window [1100, 1150] -> 1120
+    CHECK_EQ(timer.getInterval(), 100u);
+    CHECK_EQ(timer.timeLeft(), 120u);
+    ManualClock::t = 1119;
+    CHECK(!timer.isExpired());
+    ManualClock::t = 1120;
+    CHECK(timer.isExpired());
+    CHECK_EQ(timer.deadline().remaining(ManualClock::now()), 0u);
+
+    timer.next();                               // unstretched period: 1220, not 1240
+    ManualClock::t = 1219;
+    CHECK(!timer.isExpired());
+    ManualClock::t = 1220;
+    CHECK(timer.isExpired());
+
+    // stretch across the counter wrap
+    ManualClock::t = 0xFFFF'FF00u;
+    timer.nextWithSlack(0x80u, 0x100u);         // window [0xFFFFFF80, 0x80] -> 0
+    CHECK_EQ(timer.timeLeft(), 0x100u);
+    ManualClock::t = 0xFFFF'FFFFu;
+    CHECK(!timer.isExpired());
+    ManualClock::t = 0;
+    CHECK(timer.isExpired());
+    CHECK_EQ(timer.getInterval(), 0x80u);
+
+    // expireIn: shorter and longer than the interval, interval kept
+    ManualClock::t = 5000;
+    timer.next(100u);
+    timer.expireIn(5000, 30);
+    CHECK_EQ(timer.timeLeft(), 30u);
+    timer.expireIn(5000, 250);
+    CHECK_EQ(timer.timeLeft(), 250u);
+    CHECK_EQ(timer.getInterval(), 100u);
+}
+
+static void vtimer()
+{
+    for (u32 i = 0; i < 1000; ++i) {
+        DomainTicks::tick();                    // domain clock at 1000
+    }
+    DomainVTimer<TestDomain> vt(100);
+    vt.nextWithSlack(50);                       // window [1100, 1150] -> 1120
+    CHECK_EQ(vt.getInterval(), 100u);
+    u32 ticks = 0;
+    while (!vt.isExpired() && ticks < 1000u) {
+        DomainTicks::tick();
+        ++ticks;
+    }
+    CHECK_EQ(DomainTicks::ticks(), 1120u);
+
+    vt.next();                                  // plain period from 1120
+    ticks = 0;
+    while (!vt.isExpired() && ticks < 1000u) {
+        DomainTicks::tick();
+        ++ticks;
+    }
+    CHECK_EQ(ticks, 100u);
+}
+
+int main()
+{
+    itimer();
+    vtimer();
+    return test_result("SlackTest");
+}
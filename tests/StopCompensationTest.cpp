@@ -0,0 +1,103 @@
+/*
+ * StopCompensationTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * StopCompensation on SimLowPowerClock: the slept time lands in HostTick,
+ * VTimer and AutoVTimer as if SysTick had kept running; sub-tick remainders
+ * carry over between short sleeps; a 16-bit LP counter may wrap during a sleep
+ *
+ * Sources: virtual/VTimer.cpp virtual/AutoVTimer.cpp
+ */
+
+#include "time/LowPower.h"
+#include "time/tests/test_common.h"
+
+using Lp   = SimLowPowerClock<32768u>;
+using Stop = StopCompensation<Lp>;
+
+static void tick(const u32 n)
+{
+    for (u32 i = 0; i < n; ++i) {
+        HostTick::advance(1);
+        HAL_SYSTICK_Callback();
+    }
+}
+
+static void registries()
+{
+    VTimer     shortV(100);
+    VTimer     longV(5000);
+    AutoVTimer periodic(30);
+    tick(10);                                   // awake for 10 ms
+
+    const u32 t0 = HostTick::now();
+    const u32 n = Stop::sleep([] { Lp::sleep(32768u); });   // 1 s in STOP
+    CHECK_EQ(n, 1000u);
+    CHECK_EQ(Stop::lastSleep(), 32768u);
+    CHECK_EQ(HostTick::now() - t0, 1000u);
+
+    CHECK(shortV.isExpired());
+    CHECK_EQ(longV.timeLeft(), 5000u - 1010u);
+    // expiries at 30, 60, ..., 990 ms: 33 periods, phase continues (next at 1020)
+    CHECK_EQ(periodic.pending(), 33u);
+    CHECK_EQ(periodic.timeLeft(), 10u);
+    CHECK_EQ(periodic.expirations(), 33u);
+    tick(9);
+    CHECK_EQ(periodic.pending(), 0u);
+    tick(1);
+    CHECK_EQ(periodic.pending(), 1u);
+}
+
+static void shortSleeps()
+{
+    // 20 LP ticks = 0.61 ms: each sleep alone rounds down to 0
+    VTimer v(100);
+    const u64 total0 = Stop::total();
+    const u32 t0 = HostTick::now();
+    u32 applied = 0;
+    for (u32 i = 0; i < 3277u; ++i) {
+        Stop::enter();
+        Lp::sleep(20u);
+        applied += Stop::exit();
+    }
+    // 3277 * 20 / 32.768 = 2000.24 ms, plus what the previous sleeps left over
+    CHECK(applied == 2000u || applied == 2001u);
+    CHECK_EQ(HostTick::now() - t0, applied);
+    CHECK_EQ(Stop::total() - total0, static_cast<u64>(applied));
+    CHECK(v.isExpired());
+}
+
+// 16-bit LPTIM-like counter, 256 Hz
+struct WrappingLp
+{
+    using type_t = u32;
+    static constexpr type_t mask = 0xFFFFu;
+    static inline type_t t = 0;
+    static type_t now() noexcept { return t & mask; }
+    static constexpr u32 ticksPerSecond() noexcept { return 256u; }
+};
+
+static void counterWrap()
+{
+    using WStop = StopCompensation<WrappingLp>;
+    WrappingLp::t = 0xFF00u;
+    const u32 t0 = HostTick::now();
+    WStop::enter();
+    WrappingLp::t += 0x200u;                    // 2 s, through 0xFFFF -> 0
+    CHECK_EQ(WStop::exit(), 2000u);
+    CHECK_EQ(WStop::lastSleep(), 0x200u);
+    CHECK_EQ(HostTick::now() - t0, 2000u);
+
+    WStop::enter();                             // nothing slept: nothing applied
+    CHECK_EQ(WStop::exit(), 0u);
+}
+
+int main()
+{
+    registries();
+    shortSleeps();
+    counterWrap();
+    return test_result("StopCompensationTest");
+}
@@ -0,0 +1,102 @@
+/*
+ * VTimerDomainTest.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Two independent BasicVTimer domains: a tick of one scans only its own
+ * registry and advances only its own ticks(); VTimerPrescaler drives the
+ * slow domain once per Divider calls; ticks() read from another thread
+ * while the domain ticks (build with -fsanitize=thread to check the
+ * counter is race-free)
+ */
+
+#include "time/virtual.h"
+#include "time/tests/test_common.h"
+#include <atomic>
+#include <thread>
+
+struct FastDomain {};
+struct SlowDomain {};
+using Fast    = BasicVTimer<FastDomain>;
+using Slow    = BasicVTimer<SlowDomain>;
+using SlowDiv = VTimerPrescaler<SlowDomain, 4>;
+
+static void independent()
+{
+    Fast f(3);
+    Slow s(2);
+    CHECK_EQ(Fast::nextExpiry(), 3u);
+    CHECK_EQ(Slow::nextExpiry(), 2u);
+
+    for (u32 i = 0; i < 10; ++i) {
+        Fast::tick();
+    }
+    CHECK(f.isExpired());
+    CHECK_EQ(s.timeLeft(), 2u);                 // not in the fast registry
+    CHECK_EQ(Fast::ticks(), 10u);
+    CHECK_EQ(Slow::ticks(), 0u);
+    CHECK_EQ(Fast::nextExpiry(), 0u);
+
+    Slow::advance(1);
+    CHECK_EQ(s.timeLeft(), 1u);
+    CHECK_EQ(Slow::ticks(), 1u);
+    CHECK_EQ(Fast::ticks(), 10u);
+
+    {
+        Slow gone(5);
+    }                                           // erased from its own registry only
+    f.next(7);
+    CHECK_EQ(Fast::nextExpiry(), 7u);
+    CHECK_EQ(Slow::nextExpiry(), 1u);
+}
+
+static void prescaler()
+{
+    Slow s(3);
+    const u32 t0 = Slow::ticks();
+    u32 calls = 0;
+    while (!s.isExpired() && calls < 100u) {
+        SlowDiv::tick();
+        ++calls;
+    }
+    CHECK_EQ(calls, 3u * 4u);
+    CHECK_EQ(Slow::ticks() - t0, 3u);
+
+    for (u32 i = 0; i < 4u * 25u + 3u; ++i) {
+        SlowDiv::tick();
+    }
+    CHECK_EQ(Slow::ticks() - t0, 3u + 25u);     // the 3 extra calls are pending phase
+    SlowDiv::tick();
+    CHECK_EQ(Slow::ticks() - t0, 3u + 26u);
+}
+
+static void concurrentReads()
+{
+    std::atomic<bool> done{false};
+    u32 bad = 0;
+    std::thread reader([&] {
+        u32 last = Fast::ticks();
+        while (!done.load(std::memory_order_acquire)) {
+            const u32 t = Fast::ticks();
+            bad += (t - last > 0x8000'0000u) ? 1u : 0u;     // never goes back
+            last = t;
+        }
+    });
+    const u32 t0 = Fast::ticks();
+    for (u32 i = 0; i < 200'000u; ++i) {
+        Fast::tick();
+    }
+    done.store(true, std::memory_order_release);
+    reader.join();
+    CHECK_EQ(bad, 0u);
+    CHECK_EQ(Fast::ticks() - t0, 200'000u);
+}
+
+int main()
+{
+    independent();
+    prescaler();
+    concurrentReads();
+    return test_result("VTimerDomainTest");
+}
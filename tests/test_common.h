@@ -0,0 +1,42 @@
+/*
+ * test_common.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: admin
+ *
+ * Minimal check macros for the host tests (no framework, exit code = failures)
+ */
+
+#ifndef STM32_TOOLS_TIME_TESTS_TEST_COMMON_H_
+#define STM32_TOOLS_TIME_TESTS_TEST_COMMON_H_
+
+#include <cstdio>
+
+inline int test_failures = 0;
+
+#define CHECK(cond)                                                                  \
+    do {                                                                             \
+        if (!(cond)) {                                                               \
+            std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);     \
+            ++test_failures;                                                         \
+        }                                                                            \
+    } while (0)
+
+#define CHECK_EQ(a, b)                                                               \
+    do {                                                                             \
+        const auto _a = (a);                                                         \
+        const auto _b = (b);                                                         \
+        if (!(_a == _b)) {                                                           \
+            std::printf("%s:%d: CHECK_EQ(%s, %s) failed: %llu != %llu\n", __FILE__,  \
+                        __LINE__, #a, #b, static_cast<unsigned long long>(_a),       \
+                        static_cast<unsigned long long>(_b));                        \
+            ++test_failures;                                                         \
+        }                                                                            \
+    } while (0)
+
+inline int test_result(const char* name) {
+    std::printf("%s: %s (%d failure(s))\n", name, test_failures ? "FAILED" : "OK", test_failures);
+    return test_failures ? 1 : 0;
+}
+
+#endif /* STM32_TOOLS_TIME_TESTS_TEST_COMMON_H_ */
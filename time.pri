@@ -5,33 +5,66 @@ include(gnu/gnumapfile.pri)
 include(clang/clangmapfile.pri)
 
 HEADERS += \
+    $$PWD/AutoClock.h \
+    $$PWD/CachedClock.h \
+    $$PWD/ClockSync.h \
+    $$PWD/CpuMonitor.h \
     $$PWD/Dwt.h \
+    $$PWD/DwtClock.h \
     $$PWD/HTimer.h \
+    $$PWD/HostTick.h \
+    $$PWD/HostTimerService.h \
+    $$PWD/LinuxClock.h \
+    $$PWD/LowPower.h \
+    $$PWD/PrecisionWait.h \
+    $$PWD/RateMeter.h \
+    $$PWD/Simulator.h \
     $$PWD/Tick.h \
     $$PWD/irq/IRQGuard.h \
     $$PWD/itime_depency.h \
     $$PWD/itime_policy.h \
     $$PWD/interval.h \
+    $$PWD/lock_policy.h \
     $$PWD/thirdparty/basic_types.h \
     $$PWD/thirdparty/macro.h \
     $$PWD/thirdparty/status.h \
     $$PWD/thirdparty/tools.h \
     $$PWD/virtual.h \
     \
+    $$PWD/capture/CaptureMeter.h \
+    $$PWD/capture/HostCapture.h \
+    \
+    $$PWD/compare/CompareTimer.h \
+    $$PWD/compare/HostCompare.h \
+    \
+    $$PWD/interval/Deadline.h \
     $$PWD/interval/OneShotIBase.h \
     $$PWD/interval/ITimeBase.h \
     $$PWD/interval/OneShotITimer.h \
+    $$PWD/interval/PackedOneShotIBase.h \
+    $$PWD/interval/PackedOneShotITimer.h \
+    $$PWD/interval/SeqITimeBase.h \
+    $$PWD/interval/SeqITimer.h \
     $$PWD/interval/StackITimer.h \
     \
+    $$PWD/virtual/AutoVTimer.h \
     $$PWD/virtual/OneShotVBase.h \
     $$PWD/virtual/OneShotVTimer.h \
     $$PWD/virtual/StackVTimer.h \
     $$PWD/virtual/VTimeBase.h \
     $$PWD/virtual/VTimer.h \
+    \
+    $$PWD/scheduler/EdfDispatcher.h \
+    $$PWD/scheduler/HeartbeatSupervisor.h \
+    $$PWD/scheduler/Slack.h \
 	
 	
 
 SOURCES += \
     $$PWD/Dwt.cpp\
 	$$PWD/HTimer.cpp\
+	$$PWD/HostTick.cpp\
+	$$PWD/LinuxClock.cpp\
+	$$PWD/Simulator.cpp\
+	$$PWD/virtual/AutoVTimer.cpp \
 	$$PWD/virtual/VTimer.cpp \
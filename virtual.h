@@ -11,6 +11,14 @@
 // virtual ---------------------------------
 #include "virtual/VTimeBase.h"
 #include "virtual/OneShotVBase.h"
+#include "virtual/AutoVTimer.h"
+
+// per-domain timers: countdown and elapsed() in the domain's own ticks
+template<class Domain, auto Interval = 0u>
+using DomainVTimer = VTimeBase<Interval, DomainTick<Domain>, Domain>;
+
+template<class Domain, auto Interval = 0u>
+using OneShotVDomain = OneShotVBase<Interval, DomainTick<Domain>, Domain>;
 
 
 #endif /* STM32_TOOLS_TIME_VIRTUAL_H_ */
@@ -0,0 +1,116 @@
+/**
+ * @file AutoVTimer.cpp
+ * @brief Implementation of the AutoVTimer class (auto-reloading virtual timers).
+ *
+ * Timers are updated in the SysTick interrupt handler via the HAL_SYSTICK_Callback function
+ * (see VTimer.cpp). Registry and period changes from the main context happen under
+ * TimeLock; pending expiries are consumed by compare-and-swap, without masking.
+ *
+ * @author Shpegun60
+ * @date
+ */
+
+#include "AutoVTimer.h"
+#include "time/lock_policy.h"
+#include <algorithm>
+
+/**
+ * @brief Constructor: registers the timer and starts it if a period is given.
+ */
+AutoVTimer::AutoVTimer(const AutoVTimer::value_type period)
+{
+    TimeLock guard;
+    m_counter.store(period);
+    m_reload.store(period);
+    m_pending.store(0);
+    m_timers.emplace_back(this);
+}
+
+/**
+ * @brief Destructor: removes this timer from the auto-reload timer list.
+ */
+AutoVTimer::~AutoVTimer()
+{
+    TimeLock guard;
+    auto it = std::find(m_timers.begin(), m_timers.end(), this);
+    if (it != m_timers.end()) {
+        m_timers.erase(it);
+    }
+}
+
+void AutoVTimer::start()
+{
+    TimeLock guard;
+    m_counter.store(m_reload.load());
+    m_pending.store(0);
+}
+
+void AutoVTimer::start(const AutoVTimer::value_type period)
+{
+    TimeLock guard;
+    m_reload.store(period);
+    m_counter.store(period);
+    m_pending.store(0);
+}
+
+void AutoVTimer::stop()
+{
+    TimeLock guard;
+    m_reload.store(0);
+    m_counter.store(0);
+    m_pending.store(0);
+}
+
+/**
+ * @brief Consumes one pending expiry (compare-and-swap, retried if the tick adds one meanwhile).
+ */
+bool AutoVTimer::isExpired()
+{
+    value_type _pending = m_pending.load();
+    while (_pending != 0) {
+        if (m_pending.cas(_pending, _pending - 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Consumes all pending expiries (test-and-clear by compare-and-swap).
+ */
+AutoVTimer::value_type AutoVTimer::expirations()
+{
+    value_type _pending = m_pending.load();
+    while (_pending != 0) {
+        if (m_pending.cas(_pending, 0)) {
+            return _pending;
+        }
+    }
+    return 0;
+}
+
+void AutoVTimer::reserve(const reg n)
+{
+    TimeLock guard;
+    m_timers.reserve(n);
+}
+
+void AutoVTimer::advance(const AutoVTimer::value_type n)
+{
+    TimeLock guard;
+    proceed(n);
+}
+
+AutoVTimer::value_type AutoVTimer::nextExpiry()
+{
+    TimeLock guard;
+    value_type _min = 0;
+    for (auto* const timer : std::as_const(m_timers)) {
+        const value_type _counter = timer->m_counter.load();
+
+        if (_counter && (_min == 0 || _counter < _min)) {
+            _min = _counter;
+        }
+    }
+    return _min;
+}
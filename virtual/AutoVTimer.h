@@ -0,0 +1,184 @@
+/**
+ * @file AutoVTimer.h
+ * @brief Declaration of the AutoVTimer class: auto-reloading periodic virtual timer.
+ *
+ * Unlike VTimer, whose counter stops at zero until the main loop calls next(),
+ * an AutoVTimer is reloaded from its period inside the SysTick interrupt the moment
+ * it reaches zero, and the interrupt counts the expiry as pending. The main loop
+ * consumes pending expiries later (compare-and-swap, see AtomicWord), so no
+ * period is lost and phase never drifts, however late the loop is.
+ *
+ * AutoVTimer nodes live in their own registry, so plain VTimer nodes keep
+ * their single-word footprint.
+ *
+ * @note Ensure that HAL_SYSTICK_Callback() is called from your SysTick interrupt handler.
+ *
+ * @author Shpegun60
+ * @date
+ */
+
+#ifndef __TOOLS_SYS_AUTOVTIMER_H__
+#define __TOOLS_SYS_AUTOVTIMER_H__
+
+#include "time/interval_depency.h"
+#include "time/lock_policy.h"
+#include <vector>
+#include <utility>
+#include <limits>
+
+class AutoVTimer
+{
+public:
+    using value_type = reg;
+    static_assert(sizeof(value_type) <= sizeof(reg), "counter write must be single-copy atomic");
+
+    /**
+     * @brief Constructor with a period.
+     *
+     * Registers the timer and, if @p period is non-zero, starts it immediately.
+     *
+     * @param period Reload value in SysTick ticks (0 keeps the timer stopped).
+     */
+    AutoVTimer(const value_type period = 0);
+
+    /**
+     * @brief Destructor.
+     *
+     * Removes the timer from the auto-reload timer list.
+     */
+    ~AutoVTimer();
+
+    /**
+     * @brief Starts (or restarts) the timer with the current period.
+     *
+     * Restarts the phase from this tick and drops pending expiries.
+     */
+    void start();
+
+    /**
+     * @brief Starts (or restarts) the timer with a new period.
+     *
+     * @param period Reload value in SysTick ticks (0 stops the timer).
+     */
+    void start(const value_type period);
+
+    /**
+     * @brief Stops the timer and drops pending expiries.
+     */
+    void stop();
+
+    /**
+     * @brief Consumes one pending expiry.
+     *
+     * Call in a loop (`while (t.isExpired()) { ... }`) to run once per elapsed period.
+     *
+     * @return true if an expiry was pending.
+     */
+    bool isExpired();
+
+    /**
+     * @brief Consumes all pending expiries at once.
+     *
+     * @return Number of periods elapsed since the last call (> 1 means overrun).
+     */
+    value_type expirations();
+
+    /// @brief Pending expiries, not consumed.
+    value_type pending() const { return m_pending.load(); }
+
+    /// @brief Ticks left until the next expiry.
+    value_type timeLeft() const { return m_counter.load(); }
+
+    /// @brief Current reload value.
+    value_type period() const { return m_reload.load(); }
+
+    /// @brief true when the timer has no period (stopped).
+    bool isStopped() const { return m_reload.load() == 0; }
+
+    static void reserve(const reg n = 5);
+
+    /**
+     * @brief Applies @p n SysTick ticks at once (SysTick halted, e.g. STOP mode).
+     *
+     * Same result as @p n ticks: every period that ended meanwhile is counted
+     * as pending, the phase continues. One pass under TimeLock, main context.
+     */
+    static void advance(const value_type n);
+
+    /**
+     * @brief Ticks until the first running timer expires, 0 if none runs.
+     *
+     * O(n) scan under TimeLock, for tick sources that skip idle ticks.
+     */
+    [[nodiscard]] static value_type nextExpiry();
+
+private:
+    /**
+     * @brief Decrements every running timer and reloads the ones that hit zero.
+     *
+     * Called from the SysTick interrupt callback.
+     */
+    static inline void proceed() {
+        for (auto* const timer : std::as_const(m_timers)) {
+            value_type _counter = timer->m_counter.load();
+
+            if (_counter) {
+                if (--_counter == 0) {
+                    _counter = timer->m_reload.load();
+                    timer->addPending(1);
+                }
+                timer->m_counter.store(_counter);
+            }
+        }
+    }
+
+    /**
+     * @brief Bulk variant of proceed(): @p n ticks, one division per expired timer.
+     */
+    static inline void proceed(const value_type n) {
+        for (auto* const timer : std::as_const(m_timers)) {
+            value_type _counter = timer->m_counter.load();
+
+            if (_counter == 0) {
+                continue;
+            }
+            if (n < _counter) {
+                timer->m_counter.store(_counter - n);
+                continue;
+            }
+
+            // expiries at _counter, _counter + reload, ... <= n
+            const value_type _reload = timer->m_reload.load();
+            const value_type _late   = n - _counter;
+            value_type _fired = 1;
+            if (_reload) {
+                _fired   += _late / _reload;
+                _counter  = _reload - (_late % _reload);
+            } else {
+                _counter  = 0;
+            }
+
+            timer->addPending(_fired);
+            timer->m_counter.store(_counter);
+        }
+    }
+
+    // Saturating, races only with the main context consuming expiries
+    inline void addPending(const value_type n) {
+        constexpr value_type _max = std::numeric_limits<value_type>::max();
+        value_type _pending = m_pending.load();
+        while (!m_pending.cas(_pending, (n > _max - _pending) ? _max : (_pending + n))) {
+        }
+    }
+
+    // Grant access to HAL_SYSTICK_Callback so it can call proceed()
+    friend void HAL_SYSTICK_Callback(void);
+
+private:
+    AtomicWord<value_type> m_counter;                       ///< Ticks until the next expiry. Zero when stopped.
+    AtomicWord<value_type> m_reload;                        ///< Period loaded into m_counter on expiry.
+    AtomicWord<value_type> m_pending;                       ///< Expiries counted by the ISR, not yet consumed.
+    static inline TIME_BOARD_LOCAL std::vector<AutoVTimer*> m_timers = {};  ///< Global list of registered AutoVTimer objects.
+};
+
+#endif /* __TOOLS_SYS_AUTOVTIMER_H__ */
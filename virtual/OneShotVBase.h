@@ -11,15 +11,16 @@
 #include "OneShotVTimer.h"
 
 //------------------------------------------------------------------------------
-// OneShotVBase<Interval, Policy>
+// OneShotVBase<Interval, Policy, Domain>
 //  - adapter over OneShotVTimer that pulls time from Policy::now()
+//  - counts down in Domain (SysTick by default)
 //------------------------------------------------------------------------------
 
-template<auto Interval, class Policy>
-class OneShotVBase : public OneShotVTimer<Interval, typename Policy::type_t>
+template<auto Interval, class Policy, class Domain = SysTickDomain>
+class OneShotVBase : public OneShotVTimer<Interval, typename Policy::type_t, Domain>
 {
     using type_t = typename Policy::type_t;
-    using Base = OneShotVTimer<Interval, type_t>;
+    using Base = OneShotVTimer<Interval, type_t, Domain>;
 
     static_assert(std::is_integral_v<type_t>,
                   "OneShotVBase: Policy::type_t must be integral");
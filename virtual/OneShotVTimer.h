@@ -9,20 +9,33 @@
 #define STM32_TOOLS_TIME_VIRTUAL_ONESHOTVTIMER_H_
 
 #include "StackVTimer.h"
-#include "irq/IRQGuard.h"
+#include <limits>
 
 //------------------------------------------------------------------------------
 // OneShotVTimer:
 //   - OneShotVTimer<>         => dynamic (interval set at runtime)
 //   - OneShotVTimer<100u>     => static interval = 100
 //   - Default interval type   => unsigned int
+//   - Domain                  => tick domain (SysTick by default)
+//   - `started`/`armed` are the two top bits of the elapsed() stamp (as in
+//     PackedOneShotITimer), so a one-shot is as large as a StackVTimer;
+//     elapsed() counts modulo 2^(bits - 2). The countdown itself is the
+//     VTimer counter and keeps the full range.
 //------------------------------------------------------------------------------
 
-template<auto Interval = 0u, typename T = reg>
+template<auto Interval = 0u, typename T = reg, class Domain = SysTickDomain>
 class OneShotVTimer
-    : public StackVTimer<Interval, T>
+    : public StackVTimer<Interval, T, Domain>
 {
-    using Base = StackVTimer<Interval, T>;
+    using Base = StackVTimer<Interval, T, Domain>;
+
+    static constexpr unsigned value_bits = std::numeric_limits<T>::digits;
+
+    // all zero = never started (or stopped): the inherited constructors need no extra init
+    static constexpr T started_bit = T(T{1} << (value_bits - 1));
+    static constexpr T armed_bit   = T(T{1} << (value_bits - 2));   ///< started and not reported yet
+    static constexpr T state_mask  = T(started_bit | armed_bit);
+    static constexpr T time_mask   = T(~state_mask);
 
 public:
     // expose type to users
@@ -38,11 +51,11 @@ public:
     /// @brief Returns true only once after expiration
     [[nodiscard]]
 	 constexpr bool isExpired() noexcept {
-        if (!_started || _expired) {
+        if ((Base::_lastTime & state_mask) != state_mask) {
             return false;
         }
         if (Base::isExpired()) {
-            _expired = true;
+            Base::_lastTime = T(Base::_lastTime & ~armed_bit);
             return true;
         }
         return false;
@@ -52,8 +65,9 @@ public:
      * StackVTimer interface
      */
     constexpr void next(const value_type now) noexcept {
+        const T started = T(Base::_lastTime & started_bit);
 		Base::next(now);
-		_expired = false;
+		stamp(now, T(started | armed_bit));
     }
 
     // Restart + set interval — compile-time error for static interval.
@@ -62,8 +76,14 @@ public:
             static_assert(!Base::is_static_interval,
                           "Cannot set interval on a static OneShotVTimer");
         }
+        const T started = T(Base::_lastTime & started_bit);
         Base::next(now, interval);
-        _expired = false;
+        stamp(now, T(started | armed_bit));
+    }
+
+    // Elapsed ticks since last start/next (modulo the stamp's time field)
+    [[nodiscard]] constexpr value_type elapsed(const value_type now) const noexcept {
+        return T(T(now - Base::_lastTime) & time_mask);
     }
 
     // Convenience assignment
@@ -78,15 +98,8 @@ public:
 
     /// @brief Start the one-shot timer from given time
     constexpr void start(const value_type now) noexcept {
-        if (Base::isExpired()) {
-            Base::next(now);
-        } else {
-            IRQGuard guard;
-            Base::next(now);
-        }
-
-        _started = true;
-        _expired = false;
+        Base::next(now);   // counter: single store, safe against the tick
+        stamp(now, state_mask);
     }
 
     // Start + set interval (compile-time error for static interval)
@@ -96,27 +109,22 @@ public:
                           "Cannot set interval on a static OneShotVTimer");
         }
 
-        if (Base::isExpired()) {
-        	Base::next(now, interval);
-        } else {
-            IRQGuard guard;
-            Base::next(now, interval);
-        }
-
-        _expired = false;
-        _started = true;
+        Base::next(now, interval);
+        stamp(now, state_mask);
     }
 
     /// @brief Stop the timer (disable further expiration until start())
     constexpr void stop() noexcept {
-        _started = false;
-        _expired = true;
+        Base::_lastTime = T(Base::_lastTime & time_mask);
         Base::stop();  // Assumes StackVTimer provides stop()
     }
 
+    [[nodiscard]] constexpr bool isStopped() const noexcept { return !(Base::_lastTime & started_bit); }
+
 private:
-    bool _started = false;
-    bool _expired = true;
+    constexpr void stamp(const value_type now, const T state) noexcept {
+        Base::_lastTime = T((now & time_mask) | state);
+    }
 };
 
 #endif /* STM32_TOOLS_TIME_VIRTUAL_ONESHOTVTIMER_H_ */
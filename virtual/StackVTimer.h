@@ -17,11 +17,12 @@
 //   - StackVTimer<>         => dynamic (interval set at runtime, ctor takes iv)
 //   - StackVTimer<100u>     => static (compile-time constant interval, no-arg ctor)
 //   - Default interval type  => unsigned int (reg)
+//   - Domain                 => tick domain the countdown lives in (SysTick by default)
 //------------------------------------------------------------------------------
 
-template<auto Interval = 0u, class T = reg>
+template<auto Interval = 0u, class T = reg, class Domain = SysTickDomain>
 class StackVTimer
-    : public VTimer,
+    : public BasicVTimer<Domain>,
       public std::conditional_t< Interval == T{0},
                                     DynamicIntervalPolicy<T>,
                                     StaticIntervalPolicy<T, Interval> >
@@ -29,7 +30,7 @@ class StackVTimer
     using Policy = std::conditional_t< Interval == T{0},
                                         DynamicIntervalPolicy<T>,
                                         StaticIntervalPolicy<T, Interval> >;
-    using Base = VTimer;
+    using Base = BasicVTimer<Domain>;
 
 
     static_assert(std::is_integral_v<T>,      "StackVTimer: T must be integral");
@@ -44,9 +45,13 @@ class StackVTimer
     static constexpr bool policy_can_set_interval = has_set_interval<Policy, T>::value;
 
 
+public:
+    using vtimer_type = BasicVTimer<Domain>;
+
     static constexpr bool is_static_interval  = (Interval != T{0});
     static constexpr bool is_dynamic_interval = !is_static_interval;
 
+private:
     // Ensure static Interval fits into T
     static_assert(!is_static_interval
                   || static_cast<unsigned long long>(Interval)
@@ -119,8 +124,8 @@ public:
 
     [[nodiscard]] static constexpr bool isAvailable() noexcept { return true; }
 
-private:
-    value_type _lastTime = value_type{};
+protected:
+    value_type _lastTime = value_type{};   ///< OneShotVTimer keeps its state in the top two bits
 };
 
 #endif /* STM32_TOOLS_TIME_VIRTUAL_STACKVTIMER_H_ */
@@ -9,17 +9,19 @@
 #define STM32_TOOLS_TIME_VIRTUAL_VTIMEBASE_H_
 
 #include "StackVTimer.h"
+#include "time/scheduler/Slack.h"
 
 //------------------------------------------------------------------------------
-// VTimeBase<Interval, Policy>
+// VTimeBase<Interval, Policy, Domain>
 //  - adapter over StackVTimer that pulls time from Policy::now()
+//  - counts down in Domain (SysTick by default)
 //------------------------------------------------------------------------------
 
-template<auto Interval, class Policy>
-class VTimeBase : public StackVTimer<Interval, typename Policy::type_t>
+template<auto Interval, class Policy, class Domain = SysTickDomain>
+class VTimeBase : public StackVTimer<Interval, typename Policy::type_t, Domain>
 {
     using type_t = typename Policy::type_t;
-    using Base = StackVTimer<Interval, type_t>;
+    using Base = StackVTimer<Interval, type_t, Domain>;
 
     static_assert(std::is_integral_v<type_t>, "VTimeBase: Policy::type_t must be integral");
 
@@ -36,6 +38,13 @@ class VTimeBase : public StackVTimer<Interval, typename Policy::type_t>
     static_assert(decltype(has_now_impl<Policy>(0))::value,
                   "VTimeBase: Policy must provide static now() convertible to type_t (optionally noexcept)");
 
+    // Detect: Policy::now() counts the Domain ticks the countdown runs on (Policy::tick_domain)
+    template<class P, class = void>
+    struct counts_domain_ticks : std::false_type {};
+    template<class P>
+    struct counts_domain_ticks<P, std::void_t<typename P::tick_domain>>
+        : std::is_same<typename P::tick_domain, Domain> {};
+
 public:
     using value_type = type_t;
 
@@ -75,6 +84,20 @@ public:
 		}
     }
 
+    // Restart, allowing expiry up to `slack` ticks late: the countdown ends on the
+    // most aligned instant of [now + interval, now + interval + slack] (Slack::align),
+    // so timers with overlapping windows expire in the same SysTick.
+    // Tick-unit policies only: alignment is computed on Policy::now(), which must
+    // count the same ticks as the countdown (not Dwt cycles or HTimer counts).
+    constexpr void nextWithSlack(const value_type slack) noexcept(noexcept(Policy::now())) {
+        static_assert(counts_domain_ticks<Policy>::value,
+                      "VTimeBase::nextWithSlack: Policy::now() must count the Domain ticks (Tick, HostTick, SimTick, DomainTick)");
+        const value_type now  = Policy::now();
+        const value_type fire = Slack::align(static_cast<value_type>(now + Base::getInterval()), slack);
+        Base::next(now);
+        Base::vtimer_type::next(static_cast<value_type>(fire - now));
+    }
+
     // Elapsed since last reset/next
     [[nodiscard]]
     constexpr value_type elapsed() const noexcept(noexcept(Policy::now())) {
@@ -2,8 +2,9 @@
  * @file VTimer.h
  * @brief Declaration of the VirtualTimer class for managing system timers.
  *
- * The VirtualTimer class provides a simple timer mechanism that relies on a global
- * container of timer objects. Each timer is decremented in the SysTick interrupt.
+ * The VirtualTimer class provides a simple timer mechanism that relies on a
+ * container of timer objects per tick domain. Each timer is decremented by its
+ * domain's tick source: SysTick for the default domain, any ISR for the others.
  * Use the provided start(), stop(), erase(), and emplace() functions to control the timer.
  *
  * @note Ensure that HAL_SYSTICK_Callback() is called from your SysTick interrupt handler.
@@ -16,31 +17,56 @@
 #define __TOOLS_SYS_VTIMER_H__
 
 #include "time/interval_depency.h"
+#include "time/lock_policy.h"
+#include <algorithm>
 #include <vector>
 #include <utility>
+#include <type_traits>
 
-class VTimer
+/**
+ * @brief Default tick domain, driven from HAL_SYSTICK_Callback().
+ *
+ * Other domains are plain tag types; each one owns its own registry and is
+ * driven by calling BasicVTimer<Tag>::tick() from its tick source:
+ *
+ *     struct MotorDomain {};                                  // 10 kHz TIM update
+ *     void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef* htim) {
+ *         if (htim == &htim6) { BasicVTimer<MotorDomain>::tick(); }
+ *     }
+ */
+struct SysTickDomain {};
+
+void HAL_SYSTICK_Callback(void);
+
+template<class Domain = SysTickDomain>
+class BasicVTimer
 {
 public:
-    using value_type = reg;
+    using value_type  = reg;
+    using domain_type = Domain;
     static_assert(sizeof(value_type) <= sizeof(reg), "counter write must be single-copy atomic");
 
     /**
      * @brief Constructor with an initial delay.
      *
      * Constructs a VirtualTimer object with the counter set to the provided delay
-     * and registers it in the global timer list.
+     * and registers it in the domain's timer list.
      *
      * @param delay Initial delay value for the timer.
      */
-    VTimer(const value_type delay = 0);
+    BasicVTimer(const value_type delay = 0) : m_counter(delay) {
+        TimeLock guard;
+        m_timers.emplace_back(this);
+    }
 
     /**
      * @brief Destructor.
      *
-     * Removes the timer from the global timer list.
+     * Removes the timer from the domain's timer list.
+     * Intentionally non-virtual: VTimer is never deleted through a base pointer,
+     * so no vptr is stored per timer and no vtable is emitted.
      */
-    virtual ~VTimer();
+    ~BasicVTimer() { erase(); }
 
     /**
      * @brief Checks if the timer has expired.
@@ -49,67 +75,237 @@ public:
      *
      * @return true if the timer is expired, false otherwise.
      */
-    bool isExpired() const { return m_counter == 0; }
-    value_type timeLeft() const { return m_counter; }
+    bool isExpired() const { return m_counter.load() == 0; }
+    value_type timeLeft() const { return m_counter.load(); }
 
     /**
      * @brief Starts the timer with a specified delay.
      *
-     * Sets the timer counter to the provided delay value.
+     * Sets the timer counter to the provided delay value. A single store:
+     * the tick decrements by compare-and-swap and never overwrites it.
+     *
+     * @param delay The delay to set for the timer.
+     */
+    void next(const value_type delay) { m_counter.store(delay); }
+
+    /**
+     * @brief Restarts the timer only if it has expired (test-and-rearm).
+     *
+     * Exactly one of several contexts racing on the same expiry gets true.
      *
      * @param delay The delay to set for the timer.
+     * @return true if the timer was expired and is now rearmed.
      */
-    void next(const value_type delay) { m_counter = delay; }
+    bool nextIfExpired(const value_type delay) {
+        value_type expected = 0;
+        return m_counter.cas(expected, delay);
+    }
 
     /**
      * @brief Stops the timer.
      *
-     * Sets the timer counter to zero.
+     * Sets the timer counter to zero (single store, no critical section).
      */
-    void stop();
+    void stop() { m_counter.store(0); }
 
     /**
-     * @brief Erases the timer from the global timer list.
+     * @brief Erases the timer from the domain's timer list.
      *
-     * Removes the current timer object from the global container.
+     * Removes the current timer object from the domain's container.
      */
-    void erase();
+    void erase() {
+        TimeLock guard;
+        auto it = std::find(m_timers.begin(), m_timers.end(), this);
+        if (it != m_timers.end()) {
+            m_timers.erase(it);
+        }
+    }
 
     /**
-     * @brief Adds (emplaces) the timer into the global timer list.
+     * @brief Adds (emplaces) the timer into the domain's timer list.
      *
-     * If the timer is not already present, it is added to the global container.
+     * If the timer is not already present, it is added to the domain's container.
      */
-    void emplace();
+    void emplace() {
+        TimeLock guard;
+        auto it = std::find(m_timers.begin(), m_timers.end(), this);
+        if (it == m_timers.end()) {
+            m_counter.store(0);
+            m_timers.emplace_back(this);
+        }
+    }
 
-    void reserve(const reg n = 5);
+    void reserve(const reg n = 5) {
+        TimeLock guard;
+        m_timers.reserve(n);
+    }
+
+    /**
+     * @brief Tick source entry point for this domain.
+     *
+     * Call from the domain's interrupt (TIM update, prescaled divider, ...).
+     * Scans only this domain's timers. The SysTick domain is driven by
+     * HAL_SYSTICK_Callback() instead.
+     */
+    static void tick() {
+        time_tick_locked([] { proceed(); });
+    }
+
+    /**
+     * @brief Applies @p n ticks at once (time the tick source was halted, e.g. STOP mode).
+     *
+     * Same result as @p n calls of tick(): counters below @p n end at zero
+     * (expired), ticks() advances by @p n. One pass under TimeLock, from the
+     * main context. See StopCompensation (LowPower.h).
+     */
+    static void advance(const value_type n) {
+        TimeLock guard;
+        proceed(n);
+    }
+
+    /**
+     * @brief Ticks until the first running timer of this domain expires, 0 if none runs.
+     *
+     * O(n) scan under TimeLock, for tick sources that skip idle ticks
+     * (tickless idle, Simulator.h).
+     */
+    [[nodiscard]] static value_type nextExpiry() {
+        TimeLock guard;
+        value_type _min = 0;
+        for (auto* const timer : std::as_const(m_timers)) {
+            const value_type _counter = timer->m_counter.load();
+
+            if (_counter && (_min == 0 || _counter < _min)) {
+                _min = _counter;
+            }
+        }
+        return _min;
+    }
+
+    /// @brief Ticks delivered to this domain so far (wraps), see DomainTick.
+    [[nodiscard]] static value_type ticks() noexcept {
+        boardSync();
+        return m_ticks.load();
+    }
 
 private:
     /**
      * @brief Decrements the counter for each registered timer.
      *
-     * This static function is called from the SysTick interrupt callback
-     * to update the timers.
+     * This static function is called from the domain's tick source
+     * to update the timers. The decrement is a compare-and-swap: if another
+     * context rearmed or stopped the timer in between, its value stands and
+     * this tick is not applied to it.
      */
     static inline void proceed() {
+        boardSync();
+        m_ticks.store(m_ticks.load() + 1u);     // writers are serialized (tick source, advance())
         for (auto* const timer : std::as_const(m_timers)) {
-            value_type _counter = timer->m_counter;
+            value_type _counter = timer->m_counter.load();
 
             if (_counter) {
-            	--_counter;
-                timer->m_counter = _counter;
+                (void)timer->m_counter.cas(_counter, _counter - 1u);
             }
         }
     }
 
+    /**
+     * @brief Bulk variant of proceed(): subtracts @p n from every counter, saturating at zero.
+     */
+    static inline void proceed(const value_type n) {
+        boardSync();
+        m_ticks.store(m_ticks.load() + n);
+        for (auto* const timer : std::as_const(m_timers)) {
+            value_type _counter = timer->m_counter.load();
+
+            if (_counter) {
+                (void)timer->m_counter.cas(_counter, (_counter > n) ? (_counter - n) : value_type{0});
+            }
+        }
+    }
+
+    // -DTIME_SIM_BUILD: a new SimBoard on this thread starts ticks() at zero
+    static inline void boardSync() noexcept {
+#ifdef TIME_SIM_BUILD
+        if (m_board != time_board_epoch) {
+            m_board = time_board_epoch;
+            m_ticks.store(0);
+        }
+#endif
+    }
+
     // Grant access to HAL_SYSTICK_Callback so it can call proceed()
     friend void HAL_SYSTICK_Callback(void);
 
 private:
-    volatile value_type m_counter = 0;                      ///< Timer counter. When zero, the timer is expired.
-    static inline std::vector<VTimer*> m_timers = {};///< Global list of registered VirtualTimer objects.
+    AtomicWord<value_type> m_counter;                           ///< Timer counter. When zero, the timer is expired.
+    static inline TIME_BOARD_LOCAL std::vector<BasicVTimer*> m_timers = {};   ///< Per-domain list of registered VirtualTimer objects.
+    static inline TIME_BOARD_LOCAL AtomicWord<value_type> m_ticks{};          ///< Ticks delivered to this domain, read from any context.
+#ifdef TIME_SIM_BUILD
+    static inline thread_local u32 m_board = 0;                               ///< time_board_epoch m_ticks belongs to.
+#endif
 };
 
-void HAL_SYSTICK_Callback(void);
+/// @brief Timer of the default (SysTick) domain.
+using VTimer = BasicVTimer<SysTickDomain>;
+
+// Node must stay a bare counter: no vptr, no padding
+static_assert(!std::is_polymorphic_v<VTimer>, "VTimer must not carry a vtable");
+static_assert(sizeof(VTimer) == sizeof(VTimer::value_type), "VTimer node must be a single counter word");
+
+/**
+ * @brief Clock policy counting the ticks of one domain (now() = BasicVTimer<Domain>::ticks()).
+ *
+ * Lets VTimeBase/OneShotVBase measure elapsed() in the domain's own ticks.
+ */
+template<class Domain>
+class DomainTick
+{
+    STATIC_CLASS(DomainTick);
+public:
+    using type_t = typename BasicVTimer<Domain>::value_type;
+    using tick_domain = Domain;
+
+    static inline type_t now() noexcept { return BasicVTimer<Domain>::ticks(); }
+    static constexpr inline bool isAvailable() noexcept { return true; }
+};
+
+/**
+ * @brief Prescaled tick source: drives Domain once every Divider calls.
+ *
+ * Call tick() from a faster interrupt, e.g. a 1 kHz TIM update for a 1 Hz
+ * housekeeping domain, so slow timers leave the fast scans:
+ *
+ *     struct SlowDomain {};
+ *     if (htim == &htim7) { VTimerPrescaler<SlowDomain, 1000>::tick(); }
+ */
+template<class Domain, reg Divider>
+class VTimerPrescaler
+{
+    STATIC_CLASS(VTimerPrescaler);
+    static_assert(Divider > 0, "VTimerPrescaler: Divider must be non-zero");
+
+public:
+    static void tick() {
+#ifdef TIME_SIM_BUILD
+        if (m_board != time_board_epoch) {   // new SimBoard: phase restarts
+            m_board = time_board_epoch;
+            m_count = 0;
+        }
+#endif
+        reg n = m_count + 1u;
+        if (n >= Divider) {
+            n = 0;
+            BasicVTimer<Domain>::tick();
+        }
+        m_count = n;
+    }
+
+private:
+    static inline TIME_BOARD_LOCAL volatile reg m_count = 0;
+#ifdef TIME_SIM_BUILD
+    static inline thread_local u32 m_board = 0;
+#endif
+};
 
 #endif /* __TOOLS_SYS_VTIMER_H__ */